@@ -15,8 +15,16 @@
  */
 
 #include "scf_modules.hpp"
+#include "utilities/parallel_for.hpp"
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
 #include <simde/simde.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace scf {
 
@@ -47,31 +55,344 @@ given by:
              \frac{q_i q_j}{\left|\mathbf{r_i} - \mathbf{r_j}\right|}
 
 This module will compute :math:`V_{SQ}`, including in the common scenario where
-:math:`S` equals :math:`Q` (in which case terms for which the denominator is
-zero are skipped).
+:math:`S` equals :math:`Q` (in which case each pair is counted once and terms
+for which the denominator is zero are skipped).
+
+The positions and charges are first copied into contiguous arrays. Rows of
+the double sum are distributed over up to "max threads" threads (for
+:math:`S = Q` only :math:`j < i` is visited, and short and long rows are
+paired to balance the work), and each inner sum is a single branch-free
+array expression (coincident points are masked out rather than skipped) so
+that it vectorizes.
+
+If "cutoff" is positive, only pairs closer than the cutoff interact, and a
+cell list makes the cost linear in the number of charges. With "far field"
+set to "truncate" the remaining pairs are plain Coulomb interactions. With
+"damped shifted force" they use the Ewald-like damped shifted force
+potential of Fennell and Gezelter (J. Chem. Phys. 124, 234104 (2006)),
+
+.. math::
+
+   v(r) = \frac{\mathrm{erfc}(\alpha r)}{r} -
+          \frac{\mathrm{erfc}(\alpha R_c)}{R_c} +
+          \left(\frac{\mathrm{erfc}(\alpha R_c)}{R_c^2} +
+                \frac{2\alpha}{\sqrt{\pi}}
+                \frac{e^{-\alpha^2 R_c^2}}{R_c}\right)(r - R_c),
+
+with :math:`\alpha` given by "damping", which goes smoothly to zero at the
+cutoff. If "self energy" is set and :math:`S = Q`, the energy also includes
+the self term
+
+.. math::
+
+   -\left(\frac{\mathrm{erfc}(\alpha R_c)}{2 R_c} +
+          \frac{\alpha}{\sqrt{\pi}}\right)\sum_{i=1}^{N_Q} q_i^2,
+
+with which the damped shifted force energy approximates the Ewald sum of a
+neutral, condensed system.
 )";
 
+namespace {
+
+/// Structure-of-arrays copy of a set of point charges
+struct PointCharges {
+    std::vector<double> x, y, z, q;
+
+    PointCharges() = default;
+
+    explicit PointCharges(const simde::type::charges& qs) {
+        const auto n = qs.size();
+        x.reserve(n);
+        y.reserve(n);
+        z.reserve(n);
+        q.reserve(n);
+        for(const auto&& qi : qs) {
+            x.push_back(qi.x());
+            y.push_back(qi.y());
+            z.push_back(qi.z());
+            q.push_back(qi.charge());
+        }
+    }
+
+    std::size_t size() const { return q.size(); }
+
+    bool operator==(const PointCharges& rhs) const {
+        return x == rhs.x && y == rhs.y && z == rhs.z && q == rhs.q;
+    }
+};
+
+// sum_{j in [j0, j1)} q_j / |r - r_j|, skipping coincident points
+inline double potential(const PointCharges& qs, double x, double y, double z,
+                        std::size_t j0, std::size_t j1) {
+    using array_type  = Eigen::Map<const Eigen::ArrayXd>;
+    const auto n      = static_cast<Eigen::Index>(j1 - j0);
+    const double tiny = std::numeric_limits<double>::min();
+    if(n == 0) return 0.0;
+    const array_type xs(qs.x.data() + j0, n);
+    const array_type ys(qs.y.data() + j0, n);
+    const array_type zs(qs.z.data() + j0, n);
+    const array_type q(qs.q.data() + j0, n);
+
+    // mask is exactly 1 for r2 > 0 (above ~1E-292) and 0 for coincident
+    // points, whose r2 is then replaced by 1. Unlike a comparison or select,
+    // every operation here has a packet (SIMD) implementation in Eigen
+    const auto r2   = (x - xs).square() + (y - ys).square() + (z - zs).square();
+    const auto mask = r2 / (r2 + tiny);
+    return (q * mask / (r2 + (1.0 - mask)).sqrt()).sum();
+}
+
+// All pairs; for identical sets only j < i
+double all_pairs(const PointCharges& lhs, const PointCharges& rhs,
+                 bool identical, std::size_t n_threads) {
+    const auto n = lhs.size();
+    std::vector<double> e_row(n, 0.0);
+    auto row = [&](std::size_t i) {
+        const auto j1 = identical ? i : rhs.size();
+        const auto phi = potential(rhs, lhs.x[i], lhs.y[i], lhs.z[i], 0, j1);
+        e_row[i]       = lhs.q[i] * phi;
+    };
+    if(identical) {
+        // Row i has i terms, so pair row t with row n - 1 - t
+        auto rows = [&](std::size_t begin, std::size_t end) {
+            for(auto t = begin; t < end; ++t) {
+                row(t);
+                if(n - 1 - t != t) row(n - 1 - t);
+            }
+        };
+        utilities::parallel_for((n + 1) / 2, rows, n_threads);
+    } else {
+        auto rows = [&](std::size_t begin, std::size_t end) {
+            for(auto i = begin; i < end; ++i) row(i);
+        };
+        utilities::parallel_for(n, rows, n_threads);
+    }
+    double e = 0.0;
+    for(auto e_i : e_row) e += e_i;
+    return e;
+}
+
+/// The pair potential v(r) of pairs inside the cutoff
+struct CutoffPotential {
+    CutoffPotential(double cutoff, double alpha, bool shifted_force) :
+      m_rc2(cutoff * cutoff), m_alpha(alpha), m_dsf(shifted_force) {
+        if(!m_dsf) return;
+        const auto erfc_rc = std::erfc(alpha * cutoff);
+        const auto gauss =
+          2.0 * alpha / std::sqrt(M_PI) * std::exp(-alpha * alpha * m_rc2);
+        m_shift = erfc_rc / cutoff;
+        m_force = erfc_rc / m_rc2 + gauss / cutoff;
+        m_rc    = cutoff;
+    }
+
+    /// The self term of the damped shifted force energy of @p qs with itself
+    double self_energy(const PointCharges& qs) const {
+        if(!m_dsf) return 0.0;
+        double q2 = 0.0;
+        for(auto q_i : qs.q) q2 += q_i * q_i;
+        const auto erfc_rc = std::erfc(m_alpha * m_rc);
+        return -(erfc_rc / (2.0 * m_rc) + m_alpha / std::sqrt(M_PI)) * q2;
+    }
+
+    double operator()(double r2) const {
+        if(r2 >= m_rc2 || r2 == 0.0) return 0.0;
+        const auto r = std::sqrt(r2);
+        if(!m_dsf) return 1.0 / r;
+        return std::erfc(m_alpha * r) / r - m_shift + m_force * (r - m_rc);
+    }
+
+    double m_rc2;
+    double m_alpha;
+    bool m_dsf;
+    double m_shift = 0.0;
+    double m_force = 0.0;
+    double m_rc    = 0.0;
+};
+
+/** Cell list over a bounding box. Cells are at least @p cutoff wide, so
+ *  every pair closer than the cutoff is in the same or in adjacent cells.
+ *  If there would be many more cells than charges, the cells are made
+ *  larger.
+ */
+struct CellList {
+    CellList(const PointCharges& a, const PointCharges& b, double cutoff) {
+        for(std::size_t k = 0; k < 3; ++k) {
+            m_lo[k] = std::numeric_limits<double>::max();
+            double hi = std::numeric_limits<double>::lowest();
+            for(const auto* p : {&a, &b}) {
+                const auto& v = k == 0 ? p->x : (k == 1 ? p->y : p->z);
+                for(auto vi : v) {
+                    m_lo[k] = std::min(m_lo[k], vi);
+                    hi      = std::max(hi, vi);
+                }
+            }
+            m_length[k] = hi - m_lo[k];
+        }
+        const double n_max = 8.0 * double(a.size() + b.size()) + 27.0;
+        auto cell   = cutoff;
+        auto volume = m_length[0] * m_length[1] * m_length[2];
+        auto n_dims = [&]() {
+            double n = 1.0;
+            for(std::size_t k = 0; k < 3; ++k) {
+                m_dims[k] = std::max<std::size_t>(
+                  1, std::size_t(std::floor(m_length[k] / cell)));
+                n *= double(m_dims[k]);
+            }
+            return n;
+        };
+        if(n_dims() > n_max) {
+            cell = std::max(cutoff, std::cbrt(volume / n_max));
+            while(n_dims() > n_max) cell *= 1.25;
+        }
+    }
+
+    std::size_t size() const { return m_dims[0] * m_dims[1] * m_dims[2]; }
+
+    std::array<std::size_t, 3> cell(double x, double y, double z) const {
+        std::array<std::size_t, 3> rv;
+        const std::array<double, 3> r{x, y, z};
+        for(std::size_t k = 0; k < 3; ++k) {
+            const auto f = m_length[k] > 0.0 ?
+                             (r[k] - m_lo[k]) / m_length[k] * m_dims[k] :
+                             0.0;
+            rv[k] = std::min(std::size_t(std::max(f, 0.0)), m_dims[k] - 1);
+        }
+        return rv;
+    }
+
+    std::size_t index(const std::array<std::size_t, 3>& c) const {
+        return (c[0] * m_dims[1] + c[1]) * m_dims[2] + c[2];
+    }
+
+    std::array<double, 3> m_lo, m_length;
+    std::array<std::size_t, 3> m_dims;
+};
+
+// Pairs closer than the cutoff, found with a cell list
+double cutoff_pairs(const PointCharges& lhs, const PointCharges& rhs,
+                    bool identical, const CutoffPotential& v,
+                    double cutoff, std::size_t n_threads) {
+    CellList cells(lhs, rhs, cutoff);
+
+    // Sort the rhs charges by cell, so every cell is a contiguous range
+    std::vector<std::size_t> rhs_cell(rhs.size());
+    std::vector<std::size_t> start(cells.size() + 1, 0);
+    for(std::size_t j = 0; j < rhs.size(); ++j) {
+        rhs_cell[j] = cells.index(cells.cell(rhs.x[j], rhs.y[j], rhs.z[j]));
+        ++start[rhs_cell[j] + 1];
+    }
+    for(std::size_t c = 0; c < cells.size(); ++c) start[c + 1] += start[c];
+    PointCharges sorted;
+    for(auto* v_ : {&sorted.x, &sorted.y, &sorted.z, &sorted.q})
+        v_->resize(rhs.size());
+    {
+        auto next = start;
+        for(std::size_t j = 0; j < rhs.size(); ++j) {
+            const auto k = next[rhs_cell[j]]++;
+            sorted.x[k]  = rhs.x[j];
+            sorted.y[k]  = rhs.y[j];
+            sorted.z[k]  = rhs.z[j];
+            sorted.q[k]  = rhs.q[j];
+        }
+    }
+
+    // For identical sets the rows are the sorted charges themselves and
+    // each pair is visited once, from its later member (in sorted order)
+    const auto& rows = identical ? sorted : lhs;
+    std::vector<double> e_row(rows.size(), 0.0);
+    auto row = [&](std::size_t i) {
+        const auto x = rows.x[i], y = rows.y[i], z = rows.z[i];
+        const auto c = cells.cell(x, y, z);
+        double e_i   = 0.0;
+        for(int dx = -1; dx <= 1; ++dx) {
+            for(int dy = -1; dy <= 1; ++dy) {
+                for(int dz = -1; dz <= 1; ++dz) {
+                    const std::array<long, 3> n{long(c[0]) + dx,
+                                                long(c[1]) + dy,
+                                                long(c[2]) + dz};
+                    bool inside = true;
+                    for(std::size_t k = 0; k < 3; ++k)
+                        inside = inside && n[k] >= 0 &&
+                                 n[k] < long(cells.m_dims[k]);
+                    if(!inside) continue;
+                    const auto cell = cells.index(
+                      {std::size_t(n[0]), std::size_t(n[1]),
+                       std::size_t(n[2])});
+                    const auto j0 = start[cell];
+                    auto j1       = start[cell + 1];
+                    if(identical) j1 = std::min(j1, i);
+                    for(auto j = j0; j < j1; ++j) {
+                        const auto rx = x - sorted.x[j];
+                        const auto ry = y - sorted.y[j];
+                        const auto rz = z - sorted.z[j];
+                        e_i += sorted.q[j] * v(rx * rx + ry * ry + rz * rz);
+                    }
+                }
+            }
+        }
+        e_row[i] = rows.q[i] * e_i;
+    };
+    auto row_range = [&](std::size_t begin, std::size_t end) {
+        for(auto i = begin; i < end; ++i) row(i);
+    };
+    utilities::parallel_for(rows.size(), row_range, n_threads);
+
+    double e = 0.0;
+    for(auto e_i : e_row) e += e_i;
+    return e;
+}
+
+} // namespace
+
 MODULE_CTOR(CoulombsLaw) {
     description(desc);
     satisfies_property_type<pt>();
+
+    add_input<double>("cutoff")
+      .set_default(0.0)
+      .set_description("Pairs further apart than this do not interact (0 "
+                       "means all pairs interact)");
+    add_input<std::string>("far field")
+      .set_default(std::string("truncate"))
+      .set_description("Potential of pairs inside the cutoff: \"truncate\" "
+                       "or \"damped shifted force\"");
+    add_input<double>("damping")
+      .set_default(0.2)
+      .set_description("Damping parameter alpha of the damped shifted force "
+                       "potential");
+    add_input<bool>("self energy")
+      .set_default(false)
+      .set_description("Add the damped shifted force self term when the two "
+                       "sets of charges are the same?");
+    add_input<std::size_t>("max threads")
+      .set_default(std::size_t{0})
+      .set_description("Maximum number of threads (0 means all)");
 }
 
 MODULE_RUN(CoulombsLaw) {
     const auto& [qlhs, qrhs] = pt::unwrap_inputs(inputs);
+    const auto cutoff    = inputs.at("cutoff").value<double>();
+    const auto far_field = inputs.at("far field").value<std::string>();
+    const auto alpha     = inputs.at("damping").value<double>();
+    const auto add_self  = inputs.at("self energy").value<bool>();
+    const auto n_threads = inputs.at("max threads").value<std::size_t>();
+
+    if(far_field != "truncate" && far_field != "damped shifted force")
+        throw std::runtime_error("Unknown far field treatment: " + far_field);
 
     // This algorithm only works as long as qlhs and qrhs are disjoint or
     // identical
+    const PointCharges lhs(qlhs);
+    const PointCharges rhs(qrhs);
+    const bool identical = lhs == rhs;
+
     double e = 0.0;
-    for(const auto&& qi : qlhs) {
-        for(const auto&& qj : qrhs) {
-            if(qi == qj) break;
-            auto dx = qi.x() - qj.x();
-            auto dy = qi.y() - qj.y();
-            auto dz = qi.z() - qj.z();
-
-            e += qi.charge() * qj.charge() /
-                 std::sqrt(dx * dx + dy * dy + dz * dz);
-        }
+    if(cutoff > 0.0) {
+        const bool dsf = far_field == "damped shifted force";
+        CutoffPotential v(cutoff, alpha, dsf);
+        e = cutoff_pairs(lhs, rhs, identical, v, cutoff, n_threads);
+        if(dsf && identical && add_self) e += v.self_energy(lhs);
+    } else {
+        e = all_pairs(lhs, rhs, identical, n_threads);
     }
 
     auto rv = results();
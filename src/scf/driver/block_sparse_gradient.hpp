@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "../utilities/block_sparse_matrix.hpp"
+#include <optional>
+#include <simde/simde.hpp>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace scf::driver {
+
+/** @brief The SCF orbital gradient G = FPS - SPF from block-sparse matrices.
+ *
+ *  This saves time, not memory: the modules still hand the SCF loop dense
+ *  S, P, and F (and DIIS still takes a dense G), so the block-sparse copies
+ *  come on top of them. What is saved are the dense n^3 products. S is
+ *  converted once for the whole SCF, P and F once per iteration, and G and
+ *  tr(GG) are then formed block by block, neglecting blocks, and block
+ *  products, whose norm is below the threshold. The norm is therefore only
+ *  approximate; convergence has to be confirmed with the unscreened one.
+ *  Only double-precision matrices are supported (see supports()).
+ */
+class BlockSparseGradient {
+public:
+    using tensor_type = simde::type::tensor;
+    using matrix_type = utilities::BlockSparseMatrix<double>;
+
+    /// Converts @p S, tiled by @p offsets, dropping blocks below @p thresh
+    BlockSparseGradient(const tensor_type& S, utilities::block_offsets offsets,
+                        double thresh) :
+      m_offsets_(std::move(offsets)),
+      m_thresh_(thresh),
+      m_S_(convert_(S)) {}
+
+    /// Can @p t be held block sparse?
+    static bool supports(const tensor_type& t) {
+        using tensorwrapper::buffer::make_contiguous;
+        using tensorwrapper::buffer::visit_contiguous_buffer;
+        const auto& buffer = make_contiguous(t.buffer());
+        return visit_contiguous_buffer(
+          [](const auto& span) {
+              using value_t = typename std::decay_t<decltype(span)>::value_type;
+              return std::is_same_v<std::decay_t<value_t>, double>;
+          },
+          buffer);
+    }
+
+    /// Sets the density that later gradients are taken with
+    void set_density(const tensor_type& P) { m_P_ = convert_(P); }
+
+    /** @brief Forms G for @p F and the current density.
+     *
+     *  @return tr(GG), i.e., sum_mn G_mn G_nm.
+     *
+     *  @throw std::runtime_error if set_density() has not been called.
+     */
+    double compute(const tensor_type& F) {
+        if(!m_P_.has_value())
+            throw std::runtime_error("Block sparse gradient needs a density");
+        const auto F_bs = convert_(F);
+        const auto& P   = *m_P_;
+
+        auto FPS = F_bs.multiply(P, m_thresh_).multiply(m_S_, m_thresh_);
+        auto SPF = m_S_.multiply(P.multiply(F_bs, m_thresh_), m_thresh_);
+        m_G_     = FPS.add(SPF, -1.0);
+        return m_G_->dot(m_G_->transpose());
+    }
+
+    /// The last G from compute(), as a dense tensor
+    tensor_type dense_gradient() const {
+        if(!m_G_.has_value())
+            throw std::runtime_error("No block sparse gradient to densify");
+        const auto n = m_G_->dimension();
+        using tensorwrapper::utilities::make_tensor;
+        return make_tensor({n, n}, m_G_->to_dense());
+    }
+
+private:
+    matrix_type convert_(const tensor_type& t) const {
+        if(t.rank() != 2)
+            throw std::runtime_error("Block sparse gradient needs matrices");
+        using tensorwrapper::buffer::get_raw_data;
+        using tensorwrapper::buffer::make_contiguous;
+        const auto& buffer = make_contiguous(t.buffer());
+        if(buffer.shape().extent(0) != m_offsets_.back())
+            throw std::runtime_error("Block offsets don't match the matrices");
+        const auto data = get_raw_data<double>(buffer);
+        return matrix_type::from_dense(data.data(), m_offsets_, m_thresh_);
+    }
+
+    utilities::block_offsets m_offsets_;
+    double m_thresh_;
+    matrix_type m_S_;
+    std::optional<matrix_type> m_P_;
+    std::optional<matrix_type> m_G_;
+};
+
+} // namespace scf::driver
@@ -32,6 +32,7 @@ inline void set_defaults(pluginplay::ModuleManager& mm) {
     mm.change_submod("Loop", "Density matrix", "Density matrix builder");
     mm.change_submod("Loop", "Diagonalizer",
                      "Generalized eigensolve via Eigen");
+    mm.change_submod("Loop", "Guess updater", "Diagonalization Fock update");
     mm.change_submod("Loop", "Fock matrix builder", "Fock matrix builder");
     mm.change_submod("Loop", "One-electron Fock operator",
                      "Restricted One-Electron Fock op");
@@ -16,6 +16,11 @@
 
 #include "../eigen_solver/eigenvector_uncertainty.hpp"
 #include "../eigen_solver/inflate_uncertainty.hpp"
+#include "../eigen_solver/warm_start.hpp"
+#include "../matrix_builder/matrix_kernels.hpp"
+#include "../update/update_history.hpp"
+#include "../utilities/block_sparse_matrix.hpp"
+#include "block_sparse_gradient.hpp"
 #include "driver.hpp"
 #include <scf/driver/commutator.hpp>
 
@@ -58,6 +63,30 @@ struct GrabNuclear : chemist::qm_operator::OperatorVisitor {
     const V_nn_type* m_pv = nullptr;
 };
 
+// Is an operator a core-Hamiltonian (T or V_en) term?
+struct IsCoreTerm : chemist::qm_operator::OperatorVisitor {
+    IsCoreTerm() : chemist::qm_operator::OperatorVisitor(false) {}
+
+    void run(const simde::type::t_e_type&) { m_core = true; }
+    void run(const simde::type::v_en_type&) { m_core = true; }
+
+    bool m_core = false;
+};
+
+// Splits a one-electron Fock operator into its T + V_en terms and the rest
+template<typename OpType>
+std::pair<OpType, OpType> split_core_terms(const OpType& f) {
+    std::pair<OpType, OpType> rv;
+    for(std::size_t i = 0; i < f.size(); ++i) {
+        const auto& op_i = f.get_operator(i);
+        IsCoreTerm visitor;
+        op_i.visit(visitor);
+        auto& part = visitor.m_core ? rv.first : rv.second;
+        part.emplace_back(f.coefficient(i), op_i.clone());
+    }
+    return rv;
+}
+
 struct ChangeTypeVisitor {
     double m_val;
     explicit ChangeTypeVisitor(double val) : m_val(val) {}
@@ -129,12 +158,19 @@ MODULE_CTOR(SCFLoop) {
     const std::size_t diis_sample_default = 5;
     add_input<bool>("DIIS").set_default(true);
     add_input<std::size_t>("DIIS max samples").set_default(diis_sample_default);
+    add_input<bool>("warm start").set_default(true);
+    add_input<bool>("core Hamiltonian cache").set_default(true);
+    add_input<double>("block sparse threshold").set_default(0.0);
+    add_input<std::string>("block sparse tiling")
+      .set_default(std::string("shell"));
+    add_input<bool>("use guess updater").set_default(false);
 
     add_submodule<elec_egy_pt<wf_type>>("Electronic energy");
     add_submodule<density_pt>("Density matrix");
     add_submodule<s_pt>("Overlap matrix builder");
     add_submodule<fock_matrix_pt>("Fock matrix builder");
     add_submodule<diagonalizer_pt>("Diagonalizer");
+    add_submodule<update_pt<wf_type>>("Guess updater");
     add_submodule<fock_pt>("One-electron Fock operator");
     add_submodule<fock_pt>("Fock operator");
     add_submodule<v_nn_pt>("Charge-charge");
@@ -153,6 +189,7 @@ MODULE_RUN(SCFLoop) {
     auto& egy_mod          = submods.at("Electronic energy");
     auto& density_mod      = submods.at("Density matrix");
     auto& diagonalizer_mod = submods.at("Diagonalizer");
+    auto& update_mod       = submods.at("Guess updater");
     auto& fock_mod         = submods.at("One-electron Fock operator");
     auto& Fock_mod         = submods.at("Fock operator");
     auto& V_nn_mod         = submods.at("Charge-charge");
@@ -166,12 +203,50 @@ MODULE_RUN(SCFLoop) {
     const auto& H_core = H_elec.core_hamiltonian();
     const auto& aos    = psi0.orbitals().from_space();
 
+    // With "use guess updater" each new set of orbitals comes from the
+    // "Guess updater" submodule (e.g., GDM) instead of from diagonalizing the
+    // (DIIS-extrapolated) Fock matrix. The history of updaters which carry
+    // one between steps (e.g., GDM's L-BFGS pairs) lives here, so it never
+    // outlives this SCF
+    const auto use_updater = inputs.at("use guess updater").value<bool>();
+    tensor_t update_history;
+
     // DIIS settings
-    const auto diis_on = inputs.at("DIIS").value<bool>();
+    const auto diis_on = inputs.at("DIIS").value<bool>() && !use_updater;
     const auto diis_max_samples =
       inputs.at("DIIS max samples").value<std::size_t>();
     diis_t diis(diis_max_samples);
 
+    // Hand the previous orbitals to diagonalizers which can use them for the
+    // Fock matrix's element type (checked per iteration, once F exists)
+    using eigen_solver::initial_guess_key;
+    const auto warm_start = inputs.at("warm start").value<bool>();
+
+    // T and V_en are the same every iteration. If "core Hamiltonian cache" is
+    // set, the loop builds their matrix h once (in the first iteration) and
+    // adds it to each Fock matrix and energy itself, so only the remaining
+    // terms go through the Fock matrix builder and the energy module
+    const auto reuse_h = inputs.at("core Hamiltonian cache").value<bool>();
+    tensor_t h;
+
+    // A positive threshold forms the orbital gradient from block-sparse F, P,
+    // and S, neglecting blocks (and block products) below the threshold. This
+    // only skips work in the products; convergence is still confirmed with
+    // the unscreened gradient
+    const auto block_thresh =
+      inputs.at("block sparse threshold").value<double>();
+    const auto tiling = inputs.at("block sparse tiling").value<std::string>();
+    utilities::block_offsets offsets;
+    if(block_thresh > 0.0) {
+        const auto& bs = aos.ao_basis_set();
+        if(tiling == "shell")
+            offsets = utilities::shell_offsets(bs);
+        else if(tiling == "atom")
+            offsets = utilities::atom_offsets(bs);
+        else
+            throw std::runtime_error("Unknown block sparse tiling: " + tiling);
+    }
+
     // Nuclear-nuclear repulsion
     GrabNuclear visitor;
     H.visit(visitor);
@@ -200,8 +275,32 @@ MODULE_RUN(SCFLoop) {
     chemist::braket::BraKet s_mn(aos, simde::type::s_e_type{}, aos);
     const auto& S = S_mod.run_as<s_pt>(s_mn);
 
+    std::optional<BlockSparseGradient> bs_grad;
+    if(block_thresh > 0.0 && BlockSparseGradient::supports(S))
+        bs_grad.emplace(S, offsets, block_thresh);
+
+    // Orbital gradient G = FPS-SPF. Returns tr(GG), screened unless
+    // "unscreened" is set; a screened G is only made dense when DIIS asks
+    // for it
+    tensor_t grad;
+    auto orbital_gradient_norm = [&](const tensor_t& F, const tensor_t& P,
+                                     bool unscreened = false) {
+        tensor_t grad_norm;
+        if(bs_grad && !unscreened) {
+            grad_norm = tensor_t(bs_grad->compute(F));
+        } else {
+            grad          = commutator(F, P, S);
+            grad_norm("") = grad("m,n") * grad("n,m");
+        }
+        return grad_norm;
+    };
+    auto orbital_gradient = [&]() {
+        return bs_grad ? bs_grad->dense_gradient() : grad;
+    };
+
     // For convergence checking
     wf_type psi_old;
+    wf_type psi_next;
     density_t rho_old;
     tensor_t e_old;
     tensor_t F_old;
@@ -218,10 +317,18 @@ MODULE_RUN(SCFLoop) {
     while(iter < max_iter) {
         // Step 1: Generate trial wavefunction
         wf_type psi;
-        if(iter > 0) {
+        if(iter > 0 && use_updater) {
+            // Orbitals the guess updater made from the last Fock operator
+            psi = psi_next;
+        } else if(iter > 0) {
             // Diagonalize the Fock matrix
+            tensor_t C_old;
+            if(warm_start && eigen_solver::uses_warm_start(
+                               diagonalizer_mod, initial_guess_key, F_old))
+                C_old = psi_old.orbitals().transform();
             const auto&& [evalues, evectors] =
-              diagonalizer_mod.run_as<diagonalizer_pt>(F_old, S);
+              eigen_solver::run_with_warm_start<diagonalizer_pt>(
+                diagonalizer_mod, initial_guess_key, C_old, F_old, S);
 
             // Construct new trial wavefunction
             cmos_t cmos(evalues, aos, evectors);
@@ -236,27 +343,54 @@ MODULE_RUN(SCFLoop) {
         chemist::braket::BraKet P_mn(aos, rho_hat, aos);
         const auto& P = density_mod.run_as<density_pt>(P_mn);
         density_t rho(P, psi.orbitals());
+        if(bs_grad) bs_grad->set_density(P);
 
         // Step 3: Construct new Fock matrix
         const auto& f_hat = fock_mod.run_as<fock_pt>(H, rho);
-        chemist::braket::BraKet f_mn(aos, f_hat, aos);
-        auto F = F_mod.run_as<fock_matrix_pt>(f_mn);
+        auto build_F      = [&](const auto& op) {
+            chemist::braket::BraKet op_mn(aos, op, aos);
+            return F_mod.run_as<fock_matrix_pt>(op_mn);
+        };
+        tensor_t F;
+        if(reuse_h) {
+            const auto& [h_hat, g_hat] = split_core_terms(f_hat);
+            if(h == tensor_t{}) h = build_F(h_hat);
+            if(g_hat.size() > 0) {
+                const auto& G = build_F(g_hat);
+                F("m,n")      = h("m,n") + G("m,n");
+            } else {
+                F = h;
+            }
+        } else {
+            F = build_F(f_hat);
+        }
 
         // Step 4: New electronic energy
         // Step 4a: New Fock operator to new electronic Hamiltonian
         // TODO: Should just be H_core + F_hat;
         const auto& F_hat = Fock_mod.run_as<fock_pt>(H, rho);
         electronic_hamiltonian H_new;
-        for(std::size_t i = 0; i < H_core.size(); ++i)
-            H_new.emplace_back(H_core.coefficient(i),
-                               H_core.get_operator(i).clone());
+        if(!reuse_h) {
+            for(std::size_t i = 0; i < H_core.size(); ++i)
+                H_new.emplace_back(H_core.coefficient(i),
+                                   H_core.get_operator(i).clone());
+        }
         for(std::size_t i = 0; i < F_hat.size(); ++i)
             H_new.emplace_back(F_hat.coefficient(i),
                                F_hat.get_operator(i).clone());
 
-        // Step 4b: New electronic hamiltonian to new electronic energy
-        chemist::braket::BraKet H_00(psi, H_new, psi);
-        auto e = egy_mod.run_as<elec_egy_pt<wf_type>>(H_00);
+        // Step 4b: New electronic hamiltonian to new electronic energy. The
+        // core-Hamiltonian part of a reused h is Tr[P h]
+        tensor_t e;
+        if(reuse_h) e = matrix_builder::symmetric_trace_product(P, h);
+        if(!reuse_h || H_new.size() > 0) {
+            chemist::braket::BraKet H_00(psi, H_new, psi);
+            auto e_rest = egy_mod.run_as<elec_egy_pt<wf_type>>(H_00);
+            if(reuse_h)
+                e("") = e("") + e_rest("");
+            else
+                e = std::move(e_rest);
+        }
 
         auto e_msg = "SCF iteration = " + std::to_string(iter) + ":";
         e_msg += "  Electronic Energy = " + e.to_string();
@@ -274,9 +408,7 @@ MODULE_RUN(SCFLoop) {
             auto dp_norm      = tensorwrapper::operations::infinity_norm(dp);
 
             // Orbital gradient: FPS-SPF
-            auto grad = commutator(F, P, S);
-            tensor_t grad_norm;
-            grad_norm("") = grad("m,n") * grad("n,m");
+            auto grad_norm = orbital_gradient_norm(F, P);
 
             // Log convergence metrics
             logger.log("  dE = " + de.to_string());
@@ -287,16 +419,25 @@ MODULE_RUN(SCFLoop) {
             auto e_conv  = check_tolerance(de.buffer(), e_tol);
             auto g_conv  = check_tolerance(grad_norm.buffer(), g_tol);
             auto dp_conv = check_tolerance(dp_norm.buffer(), dp_tol);
+
+            // A screened gradient only says the SCF may have converged
+            if(bs_grad && e_conv && g_conv && dp_conv) {
+                grad_norm = orbital_gradient_norm(F, P, true);
+                logger.log("  dG (unscreened) = " + grad_norm.to_string());
+                g_conv = check_tolerance(grad_norm.buffer(), g_tol);
+            }
             if(e_conv && g_conv && dp_conv) converged = true;
 
             // If using DIIS and not converged, extrapolate new Fock matrix
-            if(diis_on && !converged) { F = diis.extrapolate(F, grad); }
+            if(diis_on && !converged) {
+                F = diis.extrapolate(F, orbital_gradient());
+            }
         } else if(diis_on) {
             // For DIIS, still need to the orbital gradient
-            auto grad = commutator(F, P, S);
+            orbital_gradient_norm(F, P);
 
             // If using DIIS, extrapolate new Fock matrix
-            F = diis.extrapolate(F, grad);
+            F = diis.extrapolate(F, orbital_gradient());
         }
 
         // Step 6: Not converged so reset
@@ -305,6 +446,9 @@ MODULE_RUN(SCFLoop) {
         rho_old = rho;
         F_old   = F;
         if(converged) break;
+        if(use_updater)
+            psi_next = std::get<0>(update::run_with_history<update_pt<wf_type>>(
+              update_mod, update_history, f_hat, psi));
         ++iter;
     }
     if(iter == max_iter) throw std::runtime_error("SCF failed to converge");
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../utilities/parallel_for.hpp"
+#include "eigen_solver.hpp"
+#include "eigen_solver_property_types.hpp"
+#include <Eigen/Eigen>
+#include <simde/simde.hpp>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace scf::eigen_solver {
+
+namespace {
+
+/// Largest matrix size with a compile-time sized (fully unrolled) kernel
+constexpr std::size_t max_fixed_size = 8;
+
+/// Largest matrix size whose workspace lives on the stack
+constexpr std::size_t max_bounded_size = 32;
+
+// Solves one symmetric problem with Eigen matrix type MatrixType. A is
+// symmetric, so its row-major elements are mapped directly as a column-major
+// matrix.
+template<typename MatrixType, typename T>
+void solve_one(const T* A, std::size_t n, T* values, T* vectors) {
+    Eigen::Map<const MatrixType> A_map(A, n, n);
+    Eigen::SelfAdjointEigenSolver<MatrixType> es(A_map);
+    const auto& evals = es.eigenvalues();
+    const auto& evecs = es.eigenvectors();
+    for(std::size_t i = 0; i < n; ++i) {
+        values[i] = evals(i);
+        for(std::size_t j = 0; j < n; ++j) {
+            vectors[i * n + j] = evecs(i, j);
+        }
+    }
+}
+
+template<typename T, int N>
+using fixed_matrix = Eigen::Matrix<T, N, N>;
+
+// Dynamic size, but with a compile-time capacity so no heap allocation occurs
+template<typename T>
+using bounded_matrix =
+  Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor,
+                int(max_bounded_size), int(max_bounded_size)>;
+
+template<typename T>
+using dynamic_matrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+
+// Picks the fixed-size kernel for n (1 <= n <= max_fixed_size)
+template<typename T, std::size_t... Ns>
+void solve_small(const T* A, std::size_t n, T* values, T* vectors,
+                 std::index_sequence<Ns...>) {
+    ((n == Ns + 1 ?
+        solve_one<fixed_matrix<T, int(Ns) + 1>>(A, n, values, vectors) :
+        void()),
+     ...);
+}
+
+struct Kernel {
+    using tensor_t = simde::type::tensor;
+    using return_t = std::pair<tensor_t, tensor_t>;
+
+    const std::vector<tensor_t>& m_matrices;
+    std::size_t m_max_threads;
+
+    Kernel(const std::vector<tensor_t>& matrices, std::size_t max_threads) :
+      m_matrices(matrices), m_max_threads(max_threads) {}
+
+    template<typename FloatType>
+    return_t operator()(const std::span<FloatType>&) {
+        using clean_t = std::decay_t<FloatType>;
+
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error(
+              "BatchedEigenSolver: Interval types not supported");
+        } else {
+            using tensorwrapper::buffer::get_raw_data;
+            using tensorwrapper::buffer::make_contiguous;
+            const auto n_matrices = m_matrices.size();
+
+            // Sizes, offsets into the packed results, and the input data
+            std::vector<std::size_t> sizes(n_matrices);
+            std::vector<std::size_t> value_offsets(n_matrices + 1, 0);
+            std::vector<std::size_t> vector_offsets(n_matrices + 1, 0);
+            std::vector<std::span<const clean_t>> data(n_matrices);
+            for(std::size_t k = 0; k < n_matrices; ++k) {
+                const auto& buffer = make_contiguous(m_matrices[k].buffer());
+                const auto& shape  = buffer.shape();
+                if(shape.rank() != 2 || shape.extent(0) != shape.extent(1)) {
+                    throw std::runtime_error(
+                      "BatchedEigenSolver: matrices must be square");
+                }
+                const auto n          = shape.extent(0);
+                sizes[k]              = n;
+                data[k]               = get_raw_data<clean_t>(buffer);
+                value_offsets[k + 1]  = value_offsets[k] + n;
+                vector_offsets[k + 1] = vector_offsets[k] + n * n;
+            }
+
+            std::vector<clean_t> values(value_offsets.back());
+            std::vector<clean_t> vectors(vector_offsets.back());
+
+            auto solve_range = [&](std::size_t begin, std::size_t end) {
+                for(std::size_t k = begin; k < end; ++k) {
+                    const auto n   = sizes[k];
+                    const auto* pA = data[k].data();
+                    auto* pw       = values.data() + value_offsets[k];
+                    auto* pV       = vectors.data() + vector_offsets[k];
+                    if(n == 0) continue;
+                    if(n <= max_fixed_size) {
+                        solve_small(pA, n, pw, pV,
+                                    std::make_index_sequence<max_fixed_size>{});
+                    } else if(n <= max_bounded_size) {
+                        solve_one<bounded_matrix<clean_t>>(pA, n, pw, pV);
+                    } else {
+                        solve_one<dynamic_matrix<clean_t>>(pA, n, pw, pV);
+                    }
+                }
+            };
+            utilities::parallel_for(n_matrices, solve_range, m_max_threads);
+
+            using tensorwrapper::utilities::make_tensor;
+            auto rv_values  = make_tensor({values.size()}, values);
+            auto rv_vectors = make_tensor({vectors.size()}, vectors);
+            return std::make_pair(rv_values, rv_vectors);
+        }
+    }
+};
+
+} // namespace
+
+using pt = BatchedEigenSolve;
+
+const auto desc = R"(
+ Batched Eigen Solve
+ ---------------------------------
+
+ Solves many independent, symmetric eigenvalue problems in one call. The
+ problems are distributed over up to "max threads" threads (0 uses the
+ hardware concurrency). Matrices with n <= 8 use Eigen kernels with
+ compile-time sizes, matrices with n <= 32 use stack-allocated workspaces,
+ and larger matrices use the dynamically sized solver. All
+ matrices must share a floating-point type, which may not be an uncertain
+ type.
+
+ The eigenvalues and eigenvectors of the batch are packed into one tensor
+ each; see BatchedEigenSolve for the layout.
+ )";
+
+MODULE_CTOR(BatchedEigenSolver) {
+    description(desc);
+    satisfies_property_type<pt>();
+
+    add_input<std::size_t>("max threads").set_default(std::size_t{0});
+}
+
+MODULE_RUN(BatchedEigenSolver) {
+    using tensor_t         = simde::type::tensor;
+    auto&& [matrices]      = pt::unwrap_inputs(inputs);
+    const auto max_threads = inputs.at("max threads").value<std::size_t>();
+
+    auto rv = results();
+    if(matrices.empty()) return pt::wrap_results(rv, tensor_t{}, tensor_t{});
+
+    // All matrices share a type, so the first one picks the kernel
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    Kernel k(matrices, max_threads);
+    const auto& buffer0    = make_contiguous(matrices.front().buffer());
+    auto [values, vectors] = visit_contiguous_buffer(k, buffer0);
+
+    return pt::wrap_results(rv, values, vectors);
+}
+
+} // namespace scf::eigen_solver
@@ -0,0 +1,241 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "eigen_solver.hpp"
+#include "eigen_solver_property_types.hpp"
+#include <array>
+#include <cmath>
+#include <set>
+#include <simde/simde.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace scf::eigen_solver {
+
+namespace {
+
+using ao_basis_type = simde::type::ao_basis_set;
+using point_type    = std::array<double, 3>;
+
+/* A D2h operation is a sign pattern: flips[q] is true if coordinate q (x, y,
+ * z) changes sign. This covers the identity, the three C2 axes, the three
+ * mirror planes, and inversion, all about the coordinate axes.
+ */
+using operation_type = std::array<bool, 3>;
+
+// Sign an AO component picks up when coordinate q changes sign.
+//
+// Cartesian components x^a y^b z^c use the CCA order (x power descending, then
+// y power descending). Real solid harmonics are ordered m = -l, ..., l.
+int axis_parity(bool pure, int l, std::size_t component, std::size_t q) {
+    if(!pure) {
+        std::size_t k = 0;
+        for(int a = l; a >= 0; --a) {
+            for(int b = l - a; b >= 0; --b, ++k) {
+                if(k != component) continue;
+                const int power = q == 0 ? a : (q == 1 ? b : l - a - b);
+                return power % 2 == 0 ? 1 : -1;
+            }
+        }
+        throw std::runtime_error("D2hSALCs: invalid Cartesian component");
+    }
+    const int m     = int(component) - l;
+    const int abs_m = std::abs(m);
+    if(q == 0) { return (m >= 0 ? abs_m : abs_m + 1) % 2 == 0 ? 1 : -1; }
+    if(q == 1) { return m < 0 ? -1 : 1; }
+    return (l + abs_m) % 2 == 0 ? 1 : -1;
+}
+
+// True if the atomic basis sets i and j have identical shells
+bool same_shells(const ao_basis_type& aos, std::size_t i, std::size_t j,
+                 double tol) {
+    const auto& abs_i = aos[i];
+    const auto& abs_j = aos[j];
+    if(abs_i.size() != abs_j.size()) return false;
+    for(std::size_t s = 0; s < abs_i.size(); ++s) {
+        const auto shell_i = abs_i[s];
+        const auto shell_j = abs_j[s];
+        if(shell_i.l() != shell_j.l()) return false;
+        if(shell_i.pure() != shell_j.pure()) return false;
+        if(shell_i.n_primitives() != shell_j.n_primitives()) return false;
+        for(std::size_t p = 0; p < shell_i.n_primitives(); ++p) {
+            const auto prim_i = shell_i.primitive(p);
+            const auto prim_j = shell_j.primitive(p);
+            if(std::abs(prim_i.exponent() - prim_j.exponent()) > tol ||
+               std::abs(prim_i.coefficient() - prim_j.coefficient()) > tol) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+using pt = salc_conversion_t;
+
+const auto desc = R"(
+D2h Symmetry-Adapted Linear Combinations
+----------------------------------------
+
+Builds an orthogonal AO-to-SALC transform U (n_aos by n_aos) for the largest
+subgroup of D2h whose symmetry elements are the coordinate axes and planes
+through the centroid of the basis-function centers. An operation belongs to
+the group if it maps every center onto a center with the same shells
+(to within "tolerance"). The columns of U are grouped by irreducible
+representation, so U^T F U and U^T S U are block diagonal for any
+totally symmetric F and S.
+
+The molecule must be oriented with its symmetry elements along the axes; no
+reorientation is attempted. For molecules without such symmetry U is the
+identity up to a permutation.
+)";
+
+MODULE_CTOR(D2hSALCs) {
+    description(desc);
+    satisfies_property_type<pt>();
+
+    add_input<double>("tolerance").set_default(1.0E-6);
+}
+
+MODULE_RUN(D2hSALCs) {
+    const auto& [aos] = pt::unwrap_inputs(inputs);
+    const auto tol    = inputs.at("tolerance").value<double>();
+
+    const std::size_t n_centers = aos.size();
+    const std::size_t n_aos     = aos.n_aos();
+
+    // Centers relative to their centroid and the first AO of each center
+    std::vector<point_type> r(n_centers);
+    std::vector<std::size_t> ao_offset(n_centers + 1, 0);
+    point_type centroid{0.0, 0.0, 0.0};
+    for(std::size_t c = 0; c < n_centers; ++c) {
+        const auto& center = aos[c].center();
+        r[c]               = {center.x(), center.y(), center.z()};
+        for(std::size_t q = 0; q < 3; ++q) centroid[q] += r[c][q] / n_centers;
+        ao_offset[c + 1] = ao_offset[c] + aos[c].n_aos();
+    }
+    for(auto& r_c : r) {
+        for(std::size_t q = 0; q < 3; ++q) r_c[q] -= centroid[q];
+    }
+
+    // Collect the operations which map the basis set onto itself, together
+    // with the center permutation each one induces
+    std::vector<operation_type> ops;
+    std::vector<std::vector<std::size_t>> center_maps;
+    for(unsigned bits = 0; bits < 8; ++bits) {
+        operation_type op{bool(bits & 1u), bool(bits & 2u), bool(bits & 4u)};
+        std::vector<std::size_t> image(n_centers, n_centers);
+        bool is_symmetry = true;
+        for(std::size_t c = 0; c < n_centers && is_symmetry; ++c) {
+            for(std::size_t d = 0; d < n_centers; ++d) {
+                bool match = true;
+                for(std::size_t q = 0; q < 3 && match; ++q) {
+                    const double x = op[q] ? -r[c][q] : r[c][q];
+                    match          = std::abs(x - r[d][q]) <= tol;
+                }
+                if(match && same_shells(aos, c, d, tol)) {
+                    image[c] = d;
+                    break;
+                }
+            }
+            is_symmetry = image[c] != n_centers;
+        }
+        if(!is_symmetry) continue;
+        ops.push_back(op);
+        center_maps.push_back(std::move(image));
+    }
+
+    // Image (index and sign) of every AO under every operation
+    const auto n_ops = ops.size();
+    std::vector<std::size_t> ao_image(n_ops * n_aos);
+    std::vector<int> ao_sign(n_ops * n_aos);
+    for(std::size_t g = 0; g < n_ops; ++g) {
+        for(std::size_t c = 0; c < n_centers; ++c) {
+            const auto d   = center_maps[g][c];
+            std::size_t mu = ao_offset[c];
+            std::size_t nu = ao_offset[d];
+            for(const auto&& shell : aos[c]) {
+                const bool pure = shell.pure() == chemist::ShellType::pure;
+                const int l     = shell.l();
+                for(std::size_t k = 0; k < shell.size(); ++k, ++mu, ++nu) {
+                    int sign = 1;
+                    for(std::size_t q = 0; q < 3; ++q) {
+                        if(ops[g][q]) sign *= axis_parity(pure, l, k, q);
+                    }
+                    ao_image[g * n_aos + mu] = nu;
+                    ao_sign[g * n_aos + mu]  = sign;
+                }
+            }
+        }
+    }
+
+    // The irreps of the (abelian) group are the distinct restrictions of the
+    // eight D2h characters, chi_t(g) = prod_{q flipped by g} t_q
+    std::set<std::vector<int>> irreps;
+    for(unsigned bits = 0; bits < 8; ++bits) {
+        std::vector<int> chi(n_ops);
+        for(std::size_t g = 0; g < n_ops; ++g) {
+            chi[g] = 1;
+            for(std::size_t q = 0; q < 3; ++q) {
+                if(ops[g][q] && (bits & (1u << q))) chi[g] = -chi[g];
+            }
+        }
+        irreps.insert(std::move(chi));
+    }
+
+    // Project every AO onto every irrep, orthonormalizing within each irrep.
+    // Projections of symmetry-equivalent AOs are parallel and drop out.
+    std::vector<std::vector<double>> salcs;
+    for(const auto& chi : irreps) {
+        const auto first = salcs.size();
+        for(std::size_t mu = 0; mu < n_aos; ++mu) {
+            std::vector<double> v(n_aos, 0.0);
+            for(std::size_t g = 0; g < n_ops; ++g) {
+                v[ao_image[g * n_aos + mu]] += chi[g] * ao_sign[g * n_aos + mu];
+            }
+            for(std::size_t s = first; s < salcs.size(); ++s) {
+                double overlap = 0.0;
+                for(std::size_t nu = 0; nu < n_aos; ++nu) {
+                    overlap += salcs[s][nu] * v[nu];
+                }
+                for(std::size_t nu = 0; nu < n_aos; ++nu) {
+                    v[nu] -= overlap * salcs[s][nu];
+                }
+            }
+            double norm = 0.0;
+            for(auto x : v) norm += x * x;
+            norm = std::sqrt(norm);
+            if(norm < 1.0E-8) continue;
+            for(auto& x : v) x /= norm;
+            salcs.push_back(std::move(v));
+        }
+    }
+    if(salcs.size() != n_aos) {
+        throw std::runtime_error("D2hSALCs: SALCs do not span the AO space");
+    }
+
+    std::vector<double> U(n_aos * n_aos);
+    for(std::size_t j = 0; j < n_aos; ++j) {
+        for(std::size_t i = 0; i < n_aos; ++i) U[i * n_aos + j] = salcs[j][i];
+    }
+
+    using tensorwrapper::utilities::make_tensor;
+    auto rv = results();
+    return pt::wrap_results(rv, make_tensor({n_aos, n_aos}, U));
+}
+
+} // namespace scf::eigen_solver
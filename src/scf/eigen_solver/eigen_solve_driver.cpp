@@ -15,6 +15,7 @@
  */
 
 #include "eigen_solver.hpp"
+#include "warm_start.hpp"
 
 #include <pluginplay/submodule_request.hpp>
 #include <simde/simde.hpp>
@@ -33,6 +34,9 @@ Routes normal eigenvalue problems to the appropriate backend based on the
 floating-point type stored in the input matrix. Plain ``float``/``double``
 matrices use the deterministic Eigen backend; uncertain and interval types use
 ball-arithmetic certification.
+
+The optional "initial rotation" input is forwarded to the selected backend if
+that backend accepts it.
 )";
 
 constexpr const char* kNoneSubmodule      = "none";
@@ -45,23 +49,22 @@ struct Router {
     using return_t = std::tuple<simde::type::tensor, simde::type::tensor>;
 
     const simde::type::tensor& m_A;
+    const simde::type::tensor& m_V0;
     pluginplay::type::submodule_map& m_submods;
 
-    Router(const simde::type::tensor& A,
+    Router(const simde::type::tensor& A, const simde::type::tensor& V0,
            pluginplay::type::submodule_map& submods) :
-      m_A(A), m_submods(submods) {}
+      m_A(A), m_V0(V0), m_submods(submods) {}
 
     template<typename FloatType>
     return_t operator()(const std::span<FloatType>&) {
         using clean_t = std::decay_t<FloatType>;
+        return run(eigen_backend_key<clean_t>());
+    }
 
-        if constexpr(tensorwrapper::types::is_uncertain_v<clean_t>) {
-            return m_submods.at(kUncertainSubmodule).run_as<pt>(m_A);
-        } else if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
-            return m_submods.at(kIntervalSubmodule).run_as<pt>(m_A);
-        } else {
-            return m_submods.at(kNoneSubmodule).run_as<pt>(m_A);
-        }
+    return_t run(const char* key) {
+        auto& submod = m_submods.at(key);
+        return run_with_warm_start<pt>(submod, initial_rotation_key, m_V0, m_A);
     }
 };
 
@@ -74,15 +77,21 @@ MODULE_CTOR(EigenSolveDriver) {
     add_submodule<pt>(kNoneSubmodule);
     add_submodule<pt>(kUncertainSubmodule);
     add_submodule<pt>(kIntervalSubmodule);
+
+    add_input<simde::type::tensor>(initial_rotation_key)
+      .set_default(simde::type::tensor{})
+      .set_description("Optional starting guess for the eigenvectors");
 }
 
 MODULE_RUN(EigenSolveDriver) {
-    auto&& [A] = pt::unwrap_inputs(inputs);
+    using tensor_t = simde::type::tensor;
+    auto&& [A]     = pt::unwrap_inputs(inputs);
+    const auto V0  = inputs.at(initial_rotation_key).value<tensor_t>();
 
     using tensorwrapper::buffer::make_contiguous;
     using tensorwrapper::buffer::visit_contiguous_buffer;
     const auto& A_buffer = make_contiguous(A.buffer());
-    Router router(A, submods);
+    Router router(A, V0, submods);
     auto [values, vectors] = visit_contiguous_buffer(router, A_buffer);
 
     auto rv = results();
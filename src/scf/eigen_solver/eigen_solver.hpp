@@ -19,16 +19,23 @@
 
 namespace scf::eigen_solver {
 
+DECLARE_MODULE(BatchedEigenSolver);
+DECLARE_MODULE(D2hSALCs);
 DECLARE_MODULE(GeneralizedEigenSolver);
 DECLARE_MODULE(EigenSolveDriver);
 DECLARE_MODULE(EigenGeneralized);
 DECLARE_MODULE(EigenNormal);
 DECLARE_MODULE(JacobiNormal);
+DECLARE_MODULE(MixedPrecisionNormal);
+DECLARE_MODULE(SymmetryBlockedGeneralized);
+DECLARE_MODULE(TwoPhaseJacobi);
 
 inline void set_defaults(pluginplay::ModuleManager& mm) {
     mm.change_submod("Eigen Solve", "none", "Eigen Solve via Eigen");
-    mm.change_submod("Eigen Solve", "uncertain", "Eigen Solve via Jacobi");
-    mm.change_submod("Eigen Solve", "interval", "Eigen Solve via Jacobi");
+    mm.change_submod("Eigen Solve", "uncertain",
+                     "Eigen Solve via two-phase Jacobi");
+    mm.change_submod("Eigen Solve", "interval",
+                     "Eigen Solve via two-phase Jacobi");
     mm.change_submod("Generalized eigensolve", "Eigen Solve", "Eigen Solve");
 }
 
@@ -36,8 +43,14 @@ inline void load_modules(pluginplay::ModuleManager& mm) {
     mm.add_module<EigenSolveDriver>("Eigen Solve");
     mm.add_module<EigenNormal>("Eigen Solve via Eigen");
     mm.add_module<JacobiNormal>("Eigen Solve via Jacobi");
+    mm.add_module<TwoPhaseJacobi>("Eigen Solve via two-phase Jacobi");
+    mm.add_module<MixedPrecisionNormal>("Eigen Solve via mixed precision");
     mm.add_module<EigenGeneralized>("Generalized eigensolve via Eigen");
     mm.add_module<GeneralizedEigenSolver>("Generalized eigensolve");
+    mm.add_module<BatchedEigenSolver>("Batched eigen solve");
+    mm.add_module<SymmetryBlockedGeneralized>(
+      "Generalized eigensolve via symmetry blocks");
+    mm.add_module<D2hSALCs>("D2h SALCs");
     set_defaults(mm);
 }
 
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <simde/simde.hpp>
+#include <vector>
+
+namespace scf::eigen_solver {
+
+/// Builds an AO-to-SALC transform for an AO basis set
+using salc_conversion_t =
+  simde::Convert<simde::type::tensor, simde::type::ao_basis_set>;
+
+/** @brief Solves a batch of independent symmetric eigenvalue problems.
+ *
+ *  The results are packed so that the whole batch lives in one allocation per
+ *  result. For matrices of sizes n_0, n_1, ..., the eigenvalues of matrix k
+ *  start at offset n_0 + ... + n_{k-1} of "Eigenvalues" and the row-major
+ *  n_k by n_k eigenvectors (as columns) start at offset
+ *  n_0^2 + ... + n_{k-1}^2 of "Eigenvectors".
+ */
+DECLARE_PROPERTY_TYPE(BatchedEigenSolve);
+
+PROPERTY_TYPE_INPUTS(BatchedEigenSolve) {
+    using matrices_type = std::vector<simde::type::tensor>;
+    auto rv =
+      pluginplay::declare_input().add_field<const matrices_type&>("Matrices");
+    return rv;
+}
+
+PROPERTY_TYPE_RESULTS(BatchedEigenSolve) {
+    using tensor_type = simde::type::tensor;
+    auto rv           = pluginplay::declare_result()
+                .add_field<tensor_type>("Eigenvalues")
+                .add_field<tensor_type>("Eigenvectors");
+    return rv;
+}
+
+} // namespace scf::eigen_solver
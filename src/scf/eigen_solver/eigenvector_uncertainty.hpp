@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include "../utilities/parallel_for.hpp"
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
@@ -42,6 +43,14 @@ namespace detail {
  * (near-degenerate block: gauge freedom + avoids an ill-conditioned ~0
  * divisor).
  *
+ *  In matrix form the correction is C + C M, with the masked coupling matrix
+ *  M(j,i) = G(j,i) / (e_i - e_j) (zero on the diagonal and across dropped
+ *  gaps). The gap mask and its inverse are precomputed from the centers, M is
+ *  formed once, and the product is blocked over columns of the output. Column
+ *  blocks are processed concurrently for types whose arithmetic is free of
+ *  shared state (plain intervals); affine types mint new noise symbols from a
+ *  shared counter and are therefore processed on one thread.
+ *
  *  Runs for every UQ type, intervals included. This is sound here because the
  *  correction is applied ONCE to a converged solution and only reported -- it
  * is not propagated back through the SCF iterations, so the interval dependency
@@ -87,24 +96,53 @@ struct EigenvectorUncertaintyKernel {
                 sigma = std::max(sigma, row);
             }
 
-            // Eigenvalue centers.
+            // Inverse gaps 1 / (e_i - e_j), stored at (j, i); zero marks a
+            // dropped coupling (diagonal or near-degenerate pair).
             std::vector<value_t> eps_c(n);
             for(std::size_t i = 0; i < n; ++i) { eps_c[i] = uq_center(eps[i]); }
-
-            // out = C + correction, accumulated from the ORIGINAL columns so
-            // one column's correction never feeds into another.
-            for(std::size_t k = 0; k < n * n; ++k) { out[k] = C[k]; }
-            for(std::size_t i = 0; i < n; ++i) {
-                for(std::size_t j = 0; j < n; ++j) {
-                    if(i == j) { continue; }
+            std::vector<value_t> inv_gap(n * n, value_t(0));
+            for(std::size_t j = 0; j < n; ++j) {
+                for(std::size_t i = 0; i < n; ++i) {
                     const value_t gap = eps_c[i] - eps_c[j];
-                    if(std::abs(gap) <= value_t(2) * sigma) { continue; }
-                    const clean_t coeff = G[j * n + i] / clean_t(gap);
-                    for(std::size_t r = 0; r < n; ++r) {
-                        out[r * n + i] += coeff * C[r * n + j];
+                    if(i == j || std::abs(gap) <= value_t(2) * sigma) {
+                        continue;
                     }
+                    inv_gap[j * n + i] = value_t(1) / gap;
+                }
+            }
+
+            // Masked coupling matrix M(j,i) = G(j,i) / (e_i - e_j).
+            std::vector<clean_t> M(n * n, clean_t(0));
+            for(std::size_t k = 0; k < n * n; ++k) {
+                if(inv_gap[k] != value_t(0)) {
+                    M[k] = G[k] * clean_t(inv_gap[k]);
                 }
             }
+
+            // out = C + C M. Each output column only reads the ORIGINAL C, so
+            // one column's correction never feeds into another and column
+            // blocks are independent.
+            auto column_block = [&](std::size_t i_begin, std::size_t i_end) {
+                for(std::size_t r = 0; r < n; ++r) {
+                    for(std::size_t i = i_begin; i < i_end; ++i) {
+                        out[r * n + i] = C[r * n + i];
+                    }
+                    for(std::size_t j = 0; j < n; ++j) {
+                        const auto& c_rj = C[r * n + j];
+                        for(std::size_t i = i_begin; i < i_end; ++i) {
+                            if(inv_gap[j * n + i] == value_t(0)) { continue; }
+                            out[r * n + i] += c_rj * M[j * n + i];
+                        }
+                    }
+                }
+            };
+
+            using tensorwrapper::types::is_affine_v;
+            using tensorwrapper::types::is_thresholded_affine_v;
+            constexpr bool shared_state =
+              is_affine_v<clean_t> || is_thresholded_affine_v<clean_t>;
+            const std::size_t max_threads = shared_state ? 1 : 0;
+            utilities::parallel_for(n, column_block, max_threads);
         }
     }
 };
@@ -15,6 +15,7 @@
  */
 
 #include "eigen_solver.hpp"
+#include "warm_start.hpp"
 #include <wtf/fp/float_view.hpp>
 
 #include <simde/simde.hpp>
@@ -28,7 +29,16 @@ const auto desc = R"(
 Generalized Eigen Solve
 -----------------------
 
-TODO: Write me!!!
+Solves A C = B C e by symmetric orthogonalization: with B = V b V^T and
+X = V b^(-1/2), the normal problem X^T A X Y = Y e is solved by the
+"Eigen Solve" submodule and C = X Y.
+
+If the optional "initial guess" input holds B-orthonormal eigenvectors of a
+nearby problem (e.g., the previous SCF iteration's), they are mapped to the
+orthogonal basis, Y0 = X^T B C0, and forwarded to the normal solver as its
+"initial rotation". Y0 is only formed if the normal solver (or, for the Eigen
+Solve driver, the backend it selects for the type of A) uses an initial
+rotation.
 )";
 }
 
@@ -37,10 +47,16 @@ MODULE_CTOR(GeneralizedEigenSolver) {
     satisfies_property_type<pt>();
 
     add_submodule<pt_normal>("Eigen Solve");
+
+    add_input<simde::type::tensor>(initial_guess_key)
+      .set_default(simde::type::tensor{})
+      .set_description("Optional starting guess for the eigenvectors");
 }
 
 MODULE_RUN(GeneralizedEigenSolver) {
-    auto&& [A, B] = pt::unwrap_inputs(inputs);
+    using tensor_t = simde::type::tensor;
+    auto&& [A, B]  = pt::unwrap_inputs(inputs);
+    const auto C0  = inputs.at(initial_guess_key).value<tensor_t>();
 
     auto eigen_solver_mod = submods.at("Eigen Solve");
 
@@ -62,8 +78,18 @@ MODULE_RUN(GeneralizedEigenSolver) {
     CA("i,k")      = C("j,i") * A("j,k");
     A_prime("i,k") = CA("i,j") * C("j,k");
 
-    // Step 5: Diagonalize A' to get A_values and A'_vectors
-    auto [A_values, A_vectors] = eigen_solver_mod.run_as<pt_normal>(A_prime);
+    // Step 5: Diagonalize A' to get A_values and A'_vectors, warm-started
+    // from Y0 = C^T B C0 if a guess was provided
+    tensor_t Y0;
+    const bool use_y0 =
+      uses_warm_start(eigen_solver_mod, initial_rotation_key, A_prime);
+    if(use_y0 && C0 != tensor_t{}) {
+        tensor_t CB;
+        CB("i,k") = C("j,i") * B("j,k");
+        Y0("i,k") = CB("i,j") * C0("j,k");
+    }
+    auto [A_values, A_vectors] = run_with_warm_start<pt_normal>(
+      eigen_solver_mod, initial_rotation_key, Y0, A_prime);
 
     // Step 6: A_vectors = C * A'_vectors
     simde::type::tensor evectors;
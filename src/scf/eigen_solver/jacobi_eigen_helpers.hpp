@@ -15,7 +15,9 @@
  */
 
 #pragma once
+#include <Eigen/Eigenvalues>
 #include <Eigen/Jacobi>
+#include <Eigen/QR>
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
@@ -196,42 +198,22 @@ void jacobi_sweep(dynamic_matrix<T>& S, dynamic_matrix<T>& V, std::size_t n) {
     }
 }
 
+/** @brief Orders the eigenpairs of @p A_orig defined by the rotation @p V.
+ *
+ *  The eigenvalues are taken as the Rayleigh quotients diag(V^T A V) and are
+ *  sorted in increasing order of their centers. The columns of @p V are
+ *  permuted accordingly.
+ *
+ *  @param[in] V The accumulated rotations (eigenvectors are the columns).
+ *  @param[in] A_orig The matrix being diagonalized.
+ *  @param[in] n The size of the matrices (assumed to be n by n).
+ *
+ *  @return The eigenvalues and the row-major eigenvectors (as columns).
+ */
 template<typename T>
-inline std::pair<std::vector<T>, std::vector<T>> symmetric_jacobi_eigen(
-  std::span<const T> A, std::size_t n, double tol, std::size_t max_sweeps) {
-    using matrix_type = dynamic_matrix<T>;
-
-    // Copy of A, used to get eigenvalues via V^T A V at the end. We can't just
-    // use S because the Jacobi rotations are applied in-place to S, so S
-    // doesn't equal V^T A V until convergence.
-    matrix_type A_orig(n, n);
-
-    // Iterative approximation to the eigenvalues of A. Converges to a diagonal
-    // matrix.
-    matrix_type S(n, n);
-    for(std::size_t i = 0; i < n; ++i) {
-        for(std::size_t j = 0; j < n; ++j) {
-            A_orig(i, j) = A[i * n + j];
-            S(i, j)      = A[i * n + j];
-        }
-    }
-
-    // Accumulates the rotations. Converges to the eigenvectors of A.
-    matrix_type V = matrix_type::Identity(n, n);
-    using tensorwrapper::types::strictly_less;
+std::pair<std::vector<T>, std::vector<T>> sorted_eigenpairs(
+  const dynamic_matrix<T>& V, const dynamic_matrix<T>& A_orig, std::size_t n) {
     using tensorwrapper::types::uq_center;
-    for(std::size_t sweep = 0; sweep < max_sweeps; ++sweep) {
-        const auto frob_sqrt = off_diagonal_frobenius(S, n);
-        if(strictly_less(frob_sqrt, tol)) { break; }
-        if(sweep == max_sweeps - 1) {
-            throw std::runtime_error("Jacobi algorithm did not converge");
-        }
-
-        jacobi_sweep(S, V, n);
-        // Symmetrize S to prevent numerical issues from destroying symmetry.
-        S = (S + S.transpose()) / T(2.0);
-    }
-
     const auto diag = rayleigh_diagonal(V, A_orig, n);
 
     // Order eigenvalue in increasing order
@@ -252,4 +234,191 @@ inline std::pair<std::vector<T>, std::vector<T>> symmetric_jacobi_eigen(
     return {std::move(values), std::move(vectors)};
 }
 
+/** @brief Runs cyclic Jacobi sweeps starting from the rotation @p V.
+ *
+ *  The sweeps are applied to S = V^T A V, so a @p V which already (nearly)
+ *  diagonalizes @p A_orig leaves only a small residual to be swept away.
+ *
+ *  @param[in] A_orig The matrix being diagonalized.
+ *  @param[in] V The initial rotation. The identity recovers plain Jacobi.
+ *  @param[in] n The size of the matrices (assumed to be n by n).
+ *  @param[in] tol Convergence threshold on the off-diagonal Frobenius norm.
+ *  @param[in] max_sweeps The maximum number of sweeps to perform.
+ *  @param[in] require_convergence If true, failing to reach @p tol within
+ *                                 @p max_sweeps sweeps is an error. If false,
+ *                                 at most @p max_sweeps sweeps are performed.
+ *
+ *  @throw std::runtime_error if @p require_convergence is true and the sweeps
+ *                            do not converge.
+ */
+template<typename T>
+std::pair<std::vector<T>, std::vector<T>> jacobi_eigen_from(
+  const dynamic_matrix<T>& A_orig, dynamic_matrix<T> V, std::size_t n,
+  double tol, std::size_t max_sweeps, bool require_convergence = true) {
+    using tensorwrapper::types::strictly_less;
+
+    // Iterative approximation to the eigenvalues of A. Converges to a diagonal
+    // matrix.
+    dynamic_matrix<T> S = V.transpose() * A_orig * V;
+    S                   = (S + S.transpose()) / T(2.0);
+
+    for(std::size_t sweep = 0; sweep < max_sweeps; ++sweep) {
+        const auto frob_sqrt = off_diagonal_frobenius(S, n);
+        if(strictly_less(frob_sqrt, tol)) { break; }
+        if(require_convergence && sweep == max_sweeps - 1) {
+            throw std::runtime_error("Jacobi algorithm did not converge");
+        }
+
+        jacobi_sweep(S, V, n);
+        // Symmetrize S to prevent numerical issues from destroying symmetry.
+        S = (S + S.transpose()) / T(2.0);
+    }
+
+    return sorted_eigenpairs(V, A_orig, n);
+}
+
+/** @brief Turns a guess for the eigenvectors into a starting rotation.
+ *
+ *  The guess (e.g., the previous SCF iteration's eigenvectors) is generally
+ *  only approximately orthogonal, while the Jacobi sweeps require an exactly
+ *  orthogonal V. The columns are orthonormalized by a QR decomposition, with
+ *  the signs chosen so that each column stays close to its guess.
+ *
+ *  @param[in] V0 The row-major n by n guess (eigenvectors are the columns).
+ *  @param[in] n The size of the matrix.
+ *
+ *  @throw std::runtime_error if @p V0 is not n by n.
+ */
+template<typename T>
+dynamic_matrix<T> starting_rotation(std::span<const double> V0,
+                                    std::size_t n) {
+    if(V0.size() != n * n) {
+        throw std::runtime_error("Jacobi: initial rotation must be n by n");
+    }
+    dynamic_matrix<double> guess(n, n);
+    for(std::size_t i = 0; i < n; ++i) {
+        for(std::size_t j = 0; j < n; ++j) { guess(i, j) = V0[i * n + j]; }
+    }
+
+    Eigen::HouseholderQR<dynamic_matrix<double>> qr(guess);
+    dynamic_matrix<double> Q = qr.householderQ();
+    const auto& R            = qr.matrixQR();
+
+    dynamic_matrix<T> V(n, n);
+    for(std::size_t j = 0; j < n; ++j) {
+        const double sign = R(j, j) < 0.0 ? -1.0 : 1.0;
+        for(std::size_t i = 0; i < n; ++i) { V(i, j) = T(sign * Q(i, j)); }
+    }
+    return V;
+}
+
+/** @brief Symmetric eigen solve by cyclic Jacobi rotations.
+ *
+ *  @param[in] A The row-major n by n matrix to diagonalize.
+ *  @param[in] n The size of the matrix.
+ *  @param[in] tol Convergence threshold on the off-diagonal Frobenius norm.
+ *  @param[in] max_sweeps The maximum number of sweeps.
+ *  @param[in] V0 Optional row-major guess for the eigenvectors. If non-empty
+ *                the sweeps start from it (see starting_rotation) instead of
+ *                the identity, so only the residual coupling is swept away.
+ *
+ *  @throw std::runtime_error if the sweeps do not converge.
+ */
+template<typename T>
+inline std::pair<std::vector<T>, std::vector<T>> symmetric_jacobi_eigen(
+  std::span<const T> A, std::size_t n, double tol, std::size_t max_sweeps,
+  std::span<const double> V0 = {}) {
+    using matrix_type = dynamic_matrix<T>;
+
+    // Copy of A, used to get eigenvalues via V^T A V at the end. We can't just
+    // use S because the Jacobi rotations are applied in-place to S, so S
+    // doesn't equal V^T A V until convergence.
+    matrix_type A_orig(n, n);
+    for(std::size_t i = 0; i < n; ++i) {
+        for(std::size_t j = 0; j < n; ++j) { A_orig(i, j) = A[i * n + j]; }
+    }
+
+    // Accumulates the rotations. Converges to the eigenvectors of A.
+    matrix_type V = V0.empty() ? matrix_type(matrix_type::Identity(n, n)) :
+                                 starting_rotation<T>(V0, n);
+    return jacobi_eigen_from(A_orig, std::move(V), n, tol, max_sweeps);
+}
+
+/** @brief Two-phase eigen solve: fast solve of the centers, then UQ cleanup.
+ *
+ *  Phase one diagonalizes the matrix of element centers with Eigen's
+ *  self-adjoint solver in plain floating point. Phase two rotates the full
+ *  (possibly uncertain) matrix into that eigenbasis and performs at most
+ *  @p n_cleanup_sweeps Jacobi sweeps in the native arithmetic of @p T. Since
+ *  the rotated matrix is diagonal to working precision, the cleanup only has
+ *  to propagate the uncertainty, which takes one or two sweeps instead of the
+ *  O(n) sweeps cyclic Jacobi needs from the identity.
+ *
+ *  If a guess @p V0 for the eigenvectors is given (e.g., the previous SCF
+ *  iteration's), phase one instead runs cyclic Jacobi sweeps on the centers
+ *  starting from it (see starting_rotation), which only has to remove the
+ *  residual coupling. If those sweeps do not converge, phase one falls back
+ *  to the solve from scratch.
+ *
+ *  @param[in] A The row-major n by n matrix to diagonalize.
+ *  @param[in] n The size of the matrix.
+ *  @param[in] tol Convergence threshold on the off-diagonal Frobenius norm.
+ *  @param[in] n_cleanup_sweeps The maximum number of cleanup sweeps.
+ *  @param[in] V0 Optional row-major guess for the eigenvectors.
+ *
+ *  @throw std::runtime_error if the phase one eigen solve fails.
+ */
+template<typename T>
+inline std::pair<std::vector<T>, std::vector<T>> two_phase_jacobi_eigen(
+  std::span<const T> A, std::size_t n, double tol,
+  std::size_t n_cleanup_sweeps, std::span<const double> V0 = {}) {
+    using value_t     = value_type<T>;
+    using matrix_type = dynamic_matrix<T>;
+    using tensorwrapper::types::uq_center;
+
+    matrix_type A_orig(n, n);
+    dynamic_matrix<value_t> A_center(n, n);
+    for(std::size_t i = 0; i < n; ++i) {
+        for(std::size_t j = 0; j < n; ++j) {
+            A_orig(i, j)   = A[i * n + j];
+            A_center(i, j) = uq_center(A[i * n + j]);
+        }
+    }
+
+    // Phase 1: plain floating-point solve of the centers
+    auto cold_solve = [&]() {
+        Eigen::SelfAdjointEigenSolver<dynamic_matrix<value_t>> es(A_center);
+        if(es.info() != Eigen::Success) {
+            throw std::runtime_error("Two-phase Jacobi: center solve failed");
+        }
+        return dynamic_matrix<value_t>(es.eigenvectors());
+    };
+    dynamic_matrix<value_t> V_center;
+    if(V0.empty()) {
+        V_center = cold_solve();
+    } else {
+        V_center = starting_rotation<value_t>(V0, n);
+        dynamic_matrix<value_t> S = V_center.transpose() * A_center * V_center;
+        bool converged            = false;
+        for(std::size_t sweep = 0; sweep < 50 * n; ++sweep) {
+            S = (S + S.transpose()) / value_t(2);
+            if(off_diagonal_frobenius(S, n) < tol) {
+                converged = true;
+                break;
+            }
+            jacobi_sweep(S, V_center, n);
+        }
+        // A guess which Jacobi can not finish from is discarded
+        if(!converged) V_center = cold_solve();
+    }
+    matrix_type V(n, n);
+    for(std::size_t i = 0; i < n; ++i) {
+        for(std::size_t j = 0; j < n; ++j) { V(i, j) = T(V_center(i, j)); }
+    }
+
+    // Phase 2: sweep the residual of V^T A V in the native arithmetic
+    return jacobi_eigen_from(A_orig, std::move(V), n, tol, n_cleanup_sweeps,
+                             false);
+}
+
 } // namespace scf::eigen_solver::detail
@@ -16,6 +16,8 @@
 
 #include "eigen_solver.hpp"
 #include "jacobi_eigen_helpers.hpp"
+#include "tensor_centers.hpp"
+#include "warm_start.hpp"
 #include <limits>
 #include <simde/simde.hpp>
 
@@ -26,12 +28,13 @@ namespace {
 struct Kernel {
     std::size_t m_n_rows;
     std::size_t m_n_cols;
+    std::vector<double> m_V0;
 
     using tensor_t = simde::type::tensor;
     using return_t = std::pair<tensor_t, tensor_t>;
 
-    Kernel(std::size_t n_rows, std::size_t n_cols) :
-      m_n_rows(n_rows), m_n_cols(n_cols) {}
+    Kernel(std::size_t n_rows, std::size_t n_cols, std::vector<double> V0) :
+      m_n_rows(n_rows), m_n_cols(n_cols), m_V0(std::move(V0)) {}
 
     template<typename FloatType>
     return_t operator()(const std::span<FloatType>& A) {
@@ -51,8 +54,8 @@ struct Kernel {
 
         const auto max_sweeps =
           tensorwrapper::types::is_uq_type_v<clean_t> ? 2000 * n : 50 * n;
-        auto [evals, evecs] =
-          detail::symmetric_jacobi_eigen<clean_t>(A, n, tol, max_sweeps);
+        auto [evals, evecs] = detail::symmetric_jacobi_eigen<clean_t>(
+          A, n, tol, max_sweeps, m_V0);
 
         using tensorwrapper::utilities::make_tensor;
         auto values  = make_tensor({n}, evals);
@@ -70,21 +73,35 @@ const auto desc = R"(
 
  Symmetric eigen solve by cyclic Jacobi rotations using Eigen's
  JacobiRotation class.
+
+ If the optional "initial rotation" input is set (e.g., to the eigenvectors
+ of a nearby matrix, such as the previous SCF iteration's), the sweeps start
+ from the orthonormalized centers of that rotation instead of the identity.
+ Only the residual coupling then needs to be swept away, which takes a few
+ sweeps rather than O(n).
  )";
 
 MODULE_CTOR(JacobiNormal) {
     description(desc);
     satisfies_property_type<pt>();
+
+    add_input<simde::type::tensor>(initial_rotation_key)
+      .set_default(simde::type::tensor{})
+      .set_description("Optional starting guess for the eigenvectors");
 }
 
 MODULE_RUN(JacobiNormal) {
-    auto&& [A] = pt::unwrap_inputs(inputs);
+    using tensor_t = simde::type::tensor;
+    auto&& [A]     = pt::unwrap_inputs(inputs);
+    const auto V0  = inputs.at(initial_rotation_key).value<tensor_t>();
 
     using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    auto V0_centers = tensor_centers(V0);
+
     const auto& A_buffer = make_contiguous(A.buffer());
     const auto& A_shape  = A_buffer.shape();
-    Kernel k(A_shape.extent(0), A_shape.extent(1));
-    using tensorwrapper::buffer::visit_contiguous_buffer;
+    Kernel k(A_shape.extent(0), A_shape.extent(1), std::move(V0_centers));
     auto [values, vectors] = visit_contiguous_buffer(k, A_buffer);
 
     auto rv = results();
@@ -0,0 +1,256 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "eigen_solver.hpp"
+#include <Eigen/Eigen>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <simde/simde.hpp>
+#include <type_traits>
+
+namespace scf::eigen_solver {
+
+namespace {
+
+template<typename T>
+using matrix_type = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+
+template<typename T>
+using vector_type = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+
+/* Upper bound on the 2-norm of the symmetric M. For symmetric matrices
+ * ||M||_2 <= ||M||_inf (the largest absolute row sum), and ||M||_2 <= ||M||_F
+ * always; the smaller of the two is used. Both cost O(n^2).
+ */
+template<typename T>
+T symmetric_norm2_bound(const matrix_type<T>& M) {
+    const T max_row_sum = M.cwiseAbs().rowwise().sum().maxCoeff();
+    return std::min(max_row_sum, M.norm());
+}
+
+/* Ogita-Aishima refinement of the eigenpairs (X, w) of the symmetric A.
+ *
+ * Each step costs a few GEMMs in T:
+ *
+ *   R = I - X^T X,  S = X^T A X,  w_i = S_ii / (1 - R_ii),
+ *   E_ij = (S_ij + w_j R_ij) / (w_j - w_i)   if i, j are in different clusters,
+ *   E_ij = R_ij / 2                          otherwise,
+ *   X <- X + X E,
+ *
+ * where a cluster is a run of the sorted w_i whose neighbors are no more than
+ * delta = 2 (||S - diag(w)||_2 + ||A||_2 ||R||_2) apart (each 2-norm is
+ * replaced by the upper bound from symmetric_norm2_bound). The step only
+ * re-orthonormalizes the vectors within a cluster, so each cluster is then
+ * resolved by a Rayleigh-Ritz solve in T on its (small) subspace. The error
+ * is squared every step, so a float-accurate start reaches double precision
+ * in a few steps.
+ *
+ * Returns true once ||A X - X diag(w)|| / ||A|| and ||X^T X - I|| are both
+ * below tol, false if that does not happen within max_iter steps.
+ */
+template<typename T>
+bool ogita_aishima(const matrix_type<T>& A, matrix_type<T>& X,
+                   vector_type<T>& w, std::size_t max_iter, double tol) {
+    const auto n      = A.rows();
+    const T A_norm    = A.norm();
+    const T A_norm2   = symmetric_norm2_bound(A);
+    matrix_type<T> I  = matrix_type<T>::Identity(n, n);
+    matrix_type<T> AX = A * X;
+    for(std::size_t iter = 0; iter < max_iter; ++iter) {
+        matrix_type<T> R = I - X.transpose() * X;
+        matrix_type<T> S = X.transpose() * AX;
+        for(Eigen::Index i = 0; i < n; ++i) w(i) = S(i, i) / (T(1) - R(i, i));
+
+        matrix_type<T> S_off = S;
+        S_off.diagonal() -= w;
+        const T delta = T(2) * (symmetric_norm2_bound(S_off) +
+                                A_norm2 * symmetric_norm2_bound(R));
+
+        // Assign each eigenpair to a cluster of (nearly) equal eigenvalues
+        std::vector<Eigen::Index> order(n);
+        std::iota(order.begin(), order.end(), Eigen::Index{0});
+        std::sort(order.begin(), order.end(),
+                  [&](Eigen::Index i, Eigen::Index j) { return w(i) < w(j); });
+        std::vector<std::vector<Eigen::Index>> clusters;
+        std::vector<std::size_t> cluster_of(n);
+        for(Eigen::Index k = 0; k < n; ++k) {
+            const auto i = order[k];
+            const bool new_cluster = k == 0 || w(i) - w(order[k - 1]) > delta;
+            if(new_cluster) clusters.emplace_back();
+            clusters.back().push_back(i);
+            cluster_of[i] = clusters.size() - 1;
+        }
+
+        matrix_type<T> E(n, n);
+        for(Eigen::Index j = 0; j < n; ++j) {
+            for(Eigen::Index i = 0; i < n; ++i) {
+                if(cluster_of[i] != cluster_of[j]) {
+                    E(i, j) = (S(i, j) + w(j) * R(i, j)) / (w(j) - w(i));
+                } else {
+                    E(i, j) = R(i, j) / T(2);
+                }
+            }
+        }
+        X += X * E;
+
+        // Rayleigh-Ritz within each cluster
+        for(const auto& cluster : clusters) {
+            const auto m = static_cast<Eigen::Index>(cluster.size());
+            if(m == 1) continue;
+            matrix_type<T> Xc(n, m);
+            for(Eigen::Index k = 0; k < m; ++k) Xc.col(k) = X.col(cluster[k]);
+            matrix_type<T> Hc = Xc.transpose() * A * Xc;
+            Hc                = (Hc + Hc.transpose()) / T(2);
+            Eigen::SelfAdjointEigenSolver<matrix_type<T>> es(Hc);
+            Xc = Xc * es.eigenvectors();
+            for(Eigen::Index k = 0; k < m; ++k) X.col(cluster[k]) = Xc.col(k);
+        }
+
+        // Converged if the refined pairs actually are eigenpairs
+        AX = A * X;
+        for(Eigen::Index i = 0; i < n; ++i) {
+            w(i) = X.col(i).dot(AX.col(i)) / X.col(i).squaredNorm();
+        }
+        matrix_type<T> residual = AX - X * w.asDiagonal();
+        matrix_type<T> overlap  = X.transpose() * X - I;
+        if(residual.norm() < tol * A_norm && overlap.norm() < tol) return true;
+    }
+    return false;
+}
+
+struct Kernel {
+    std::size_t m_n_rows;
+    std::size_t m_n_cols;
+    std::size_t m_max_iter;
+    double m_tol;
+
+    using tensor_t = simde::type::tensor;
+    using return_t = std::pair<tensor_t, tensor_t>;
+
+    Kernel(std::size_t n_rows, std::size_t n_cols, std::size_t max_iter,
+           double tol) :
+      m_n_rows(n_rows), m_n_cols(n_cols), m_max_iter(max_iter), m_tol(tol) {}
+
+    template<typename FloatType>
+    return_t operator()(const std::span<FloatType>& A) {
+        using clean_t = std::decay_t<FloatType>;
+
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error(
+              "MixedPrecisionNormal: Interval types not supported");
+        } else {
+            if(m_n_rows != m_n_cols) {
+                throw std::runtime_error(
+                  "MixedPrecisionNormal: matrix must be square");
+            }
+            const auto n = m_n_rows;
+
+            // A is symmetric, so the row-major data maps as column-major
+            using map_type = Eigen::Map<const matrix_type<clean_t>>;
+            matrix_type<clean_t> A_full = map_type(A.data(), n, n);
+
+            // Low-precision solve
+            Eigen::SelfAdjointEigenSolver<matrix_type<float>> es_low(
+              A_full.template cast<float>());
+            matrix_type<clean_t> X =
+              es_low.eigenvectors().template cast<clean_t>();
+            vector_type<clean_t> w =
+              es_low.eigenvalues().template cast<clean_t>();
+
+            // Refine in the input precision. If the refined pairs do not
+            // satisfy the residual test, fall back to a full solve in the
+            // input precision.
+            if constexpr(sizeof(clean_t) > sizeof(float)) {
+                if(!ogita_aishima(A_full, X, w, m_max_iter, m_tol)) {
+                    Eigen::SelfAdjointEigenSolver<matrix_type<clean_t>> es(
+                      A_full);
+                    X = es.eigenvectors();
+                    w = es.eigenvalues();
+                }
+            }
+
+            // Refinement can swap nearly equal eigenvalues; restore the order
+            std::vector<std::size_t> order(n);
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(),
+                      [&](std::size_t i, std::size_t j) {
+                          return w(i) < w(j);
+                      });
+
+            std::vector<clean_t> evals(n);
+            std::vector<clean_t> evecs(n * n);
+            for(std::size_t k = 0; k < n; ++k) {
+                evals[k] = w(order[k]);
+                for(std::size_t i = 0; i < n; ++i) {
+                    evecs[i * n + k] = X(i, order[k]);
+                }
+            }
+
+            using tensorwrapper::utilities::make_tensor;
+            auto values  = make_tensor({n}, evals);
+            auto vectors = make_tensor({n, n}, evecs);
+            return std::make_pair(values, vectors);
+        }
+    }
+};
+} // namespace
+
+using pt = simde::EigenSolve;
+
+const auto desc = R"(
+ Eigen Solve via mixed precision
+ ---------------------------------
+
+ Symmetric eigen solve which diagonalizes a single-precision copy of the
+ matrix with Eigen and then refines the eigenpairs in the precision of the
+ input with the Ogita-Aishima iteration (GEMM based, quadratically
+ convergent). Eigenvalues which single precision cannot separate are refined
+ as clusters and resolved with a Rayleigh-Ritz solve on each cluster's
+ subspace. Refinement stops once the relative residual ||AX - XW|| / ||A||
+ and the orthonormality error ||X^T X - I|| are both below "refinement
+ tolerance"; if that does not happen within "max refinement iterations"
+ steps, the matrix is diagonalized in full precision instead.
+ Single-precision inputs are solved directly.
+ )";
+
+MODULE_CTOR(MixedPrecisionNormal) {
+    description(desc);
+    satisfies_property_type<pt>();
+
+    add_input<std::size_t>("max refinement iterations")
+      .set_default(std::size_t{10});
+    add_input<double>("refinement tolerance").set_default(1.0E-10);
+}
+
+MODULE_RUN(MixedPrecisionNormal) {
+    auto&& [A] = pt::unwrap_inputs(inputs);
+    const auto max_iter =
+      inputs.at("max refinement iterations").value<std::size_t>();
+    const auto tol = inputs.at("refinement tolerance").value<double>();
+
+    using tensorwrapper::buffer::make_contiguous;
+    const auto& A_buffer = make_contiguous(A.buffer());
+    const auto& A_shape  = A_buffer.shape();
+    Kernel k(A_shape.extent(0), A_shape.extent(1), max_iter, tol);
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    auto [values, vectors] = visit_contiguous_buffer(k, A_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, values, vectors);
+}
+
+} // namespace scf::eigen_solver
@@ -0,0 +1,253 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../utilities/parallel_for.hpp"
+#include "eigen_solver.hpp"
+#include "tensor_centers.hpp"
+#include <Eigen/Eigen>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <simde/simde.hpp>
+#include <vector>
+
+namespace scf::eigen_solver {
+
+namespace {
+
+/* Splits {0, ..., n-1} into the connected components of the graph with an
+ * edge (i, j) wherever |A(i,j)| > a_thresh or |B(i,j)| > b_thresh. Each
+ * component is a block of the (permuted) block-diagonal pencil. Components
+ * are returned with sorted indices, ordered by their first index.
+ */
+template<typename MatrixType>
+std::vector<std::vector<std::size_t>> find_blocks(const MatrixType& A,
+                                                  const MatrixType& B,
+                                                  double a_thresh,
+                                                  double b_thresh) {
+    const std::size_t n = A.rows();
+    std::vector<std::size_t> parent(n);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](std::size_t i) {
+        while(parent[i] != i) i = parent[i] = parent[parent[i]];
+        return i;
+    };
+
+    for(std::size_t j = 0; j < n; ++j) {
+        for(std::size_t i = 0; i < j; ++i) {
+            if(std::abs(A(i, j)) <= a_thresh && std::abs(B(i, j)) <= b_thresh) {
+                continue;
+            }
+            const auto ri = find(i);
+            const auto rj = find(j);
+            if(ri != rj) parent[std::max(ri, rj)] = std::min(ri, rj);
+        }
+    }
+
+    std::vector<std::vector<std::size_t>> blocks;
+    std::vector<std::size_t> block_of_root(n, n);
+    for(std::size_t i = 0; i < n; ++i) {
+        const auto r = find(i);
+        if(block_of_root[r] == n) {
+            block_of_root[r] = blocks.size();
+            blocks.emplace_back();
+        }
+        blocks[block_of_root[r]].push_back(i);
+    }
+    return blocks;
+}
+
+struct Kernel {
+    using tensor_t = simde::type::tensor;
+    using return_t = std::pair<tensor_t, tensor_t>;
+
+    std::size_t m_n;
+    const std::vector<double>& m_U;
+    double m_thresh;
+    std::size_t m_max_threads;
+
+    Kernel(std::size_t n, const std::vector<double>& U, double thresh,
+           std::size_t max_threads) :
+      m_n(n), m_U(U), m_thresh(thresh), m_max_threads(max_threads) {}
+
+    template<typename FloatType0, typename FloatType1>
+    return_t operator()(const std::span<FloatType0>&,
+                        const std::span<FloatType1>&) {
+        throw std::runtime_error(
+          "SymmetryBlockedGeneralized: Mixed float types not supported");
+    }
+
+    template<typename FloatType>
+    return_t operator()(const std::span<FloatType>& A,
+                        const std::span<FloatType>& B) {
+        using clean_t = std::decay_t<FloatType>;
+
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error(
+              "SymmetryBlockedGeneralized: Interval types not supported");
+        } else {
+            using matrix_type =
+              Eigen::Matrix<clean_t, Eigen::Dynamic, Eigen::Dynamic>;
+            using row_major_type =
+              Eigen::Matrix<clean_t, Eigen::Dynamic, Eigen::Dynamic,
+                            Eigen::RowMajor>;
+            using map_type = Eigen::Map<const row_major_type>;
+            const auto n   = m_n;
+
+            // Step 1: Transform to the symmetry-adapted basis
+            matrix_type U = matrix_type::Identity(n, n);
+            if(!m_U.empty()) {
+                if(m_U.size() != n * n) {
+                    throw std::runtime_error(
+                      "SymmetryBlockedGeneralized: SALC transform must be n "
+                      "by n");
+                }
+                for(std::size_t i = 0; i < n; ++i) {
+                    for(std::size_t j = 0; j < n; ++j) {
+                        U(i, j) = static_cast<clean_t>(m_U[i * n + j]);
+                    }
+                }
+            }
+            matrix_type A_salc = U.transpose() * map_type(A.data(), n, n) * U;
+            matrix_type B_salc = U.transpose() * map_type(B.data(), n, n) * U;
+
+            // Step 2: Find the blocks. Couplings below the (relative)
+            // threshold are symmetry-breaking noise and are dropped.
+            const double a_max = A_salc.cwiseAbs().maxCoeff();
+            const double b_max = B_salc.cwiseAbs().maxCoeff();
+            auto blocks = find_blocks(A_salc, B_salc, m_thresh * a_max,
+                                      m_thresh * b_max);
+
+            // Step 3: Solve the blocks concurrently
+            std::vector<matrix_type> block_vectors(blocks.size());
+            std::vector<std::vector<clean_t>> block_values(blocks.size());
+            auto solve_blocks = [&](std::size_t begin, std::size_t end) {
+                for(std::size_t b = begin; b < end; ++b) {
+                    const auto& idx = blocks[b];
+                    const auto m    = idx.size();
+                    matrix_type A_b(m, m);
+                    matrix_type B_b(m, m);
+                    for(std::size_t j = 0; j < m; ++j) {
+                        for(std::size_t i = 0; i < m; ++i) {
+                            A_b(i, j) = A_salc(idx[i], idx[j]);
+                            B_b(i, j) = B_salc(idx[i], idx[j]);
+                        }
+                    }
+                    Eigen::GeneralizedSelfAdjointEigenSolver<matrix_type> ges(
+                      A_b, B_b);
+                    const auto& w = ges.eigenvalues();
+                    block_values[b].assign(w.data(), w.data() + m);
+                    block_vectors[b] = ges.eigenvectors();
+                }
+            };
+            utilities::parallel_for(blocks.size(), solve_blocks,
+                                    m_max_threads);
+
+            // Step 4: Merge the blocks in order of increasing eigenvalue and
+            // back-transform, C(:, k) = U(:, block) y_k
+            std::vector<std::pair<std::size_t, std::size_t>> pairs;
+            pairs.reserve(n);
+            for(std::size_t b = 0; b < blocks.size(); ++b) {
+                for(std::size_t k = 0; k < blocks[b].size(); ++k) {
+                    pairs.emplace_back(b, k);
+                }
+            }
+            std::stable_sort(pairs.begin(), pairs.end(),
+                             [&](const auto& lhs, const auto& rhs) {
+                                 return block_values[lhs.first][lhs.second] <
+                                        block_values[rhs.first][rhs.second];
+                             });
+
+            std::vector<clean_t> evals(n);
+            std::vector<clean_t> evecs(n * n, clean_t(0));
+            for(std::size_t k = 0; k < n; ++k) {
+                const auto [b, k_b] = pairs[k];
+                const auto& idx     = blocks[b];
+                const auto& y       = block_vectors[b];
+                evals[k]            = block_values[b][k_b];
+                for(std::size_t r = 0; r < n; ++r) {
+                    clean_t c(0);
+                    for(std::size_t i = 0; i < idx.size(); ++i) {
+                        c += U(r, idx[i]) * y(i, k_b);
+                    }
+                    evecs[r * n + k] = c;
+                }
+            }
+
+            using tensorwrapper::utilities::make_tensor;
+            auto values  = make_tensor({n}, evals);
+            auto vectors = make_tensor({n, n}, evecs);
+            return std::make_pair(values, vectors);
+        }
+    }
+};
+} // namespace
+
+using pt = simde::GeneralizedEigenSolve;
+
+const auto desc = R"(
+Generalized Eigen Solve via Symmetry Blocks
+-------------------------------------------
+
+Solves A C = B C e block by block. Both matrices are first transformed to a
+symmetry-adapted basis, A' = U^T A U and B' = U^T B U, where the columns of
+the "SALC transform" input U are symmetry-adapted linear combinations (e.g.,
+from the "D2h SALCs" module). If no transform is given, U is the identity.
+
+The blocks are the connected components of the couplings in A' and B' which
+exceed "block threshold" times the largest element of the respective matrix;
+smaller couplings are treated as symmetry-breaking noise and dropped. Each
+block is solved with Eigen's generalized self-adjoint solver, with the blocks
+distributed over up to "max threads" threads (0 uses the hardware
+concurrency). The eigenpairs are returned in order of increasing eigenvalue.
+)";
+
+MODULE_CTOR(SymmetryBlockedGeneralized) {
+    description(desc);
+    satisfies_property_type<pt>();
+
+    add_input<simde::type::tensor>("SALC transform")
+      .set_default(simde::type::tensor{});
+    add_input<double>("block threshold").set_default(1.0E-10);
+    add_input<std::size_t>("max threads").set_default(std::size_t{0});
+}
+
+MODULE_RUN(SymmetryBlockedGeneralized) {
+    using tensor_t         = simde::type::tensor;
+    auto&& [A, B]          = pt::unwrap_inputs(inputs);
+    const auto U           = inputs.at("SALC transform").value<tensor_t>();
+    const auto thresh      = inputs.at("block threshold").value<double>();
+    const auto max_threads = inputs.at("max threads").value<std::size_t>();
+
+    using tensorwrapper::buffer::make_contiguous;
+    const auto& A_buffer = make_contiguous(A.buffer());
+    const auto& B_buffer = make_contiguous(B.buffer());
+    const auto& A_shape  = A_buffer.shape();
+    if(A_shape.extent(0) != A_shape.extent(1)) {
+        throw std::runtime_error(
+          "SymmetryBlockedGeneralized: matrix must be square");
+    }
+
+    const auto U_centers = tensor_centers(U);
+    Kernel k(A_shape.extent(0), U_centers, thresh, max_threads);
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    auto [values, vectors] = visit_contiguous_buffer(k, A_buffer, B_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, values, vectors);
+}
+
+} // namespace scf::eigen_solver
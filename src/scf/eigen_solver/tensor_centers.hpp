@@ -0,0 +1,56 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <simde/simde.hpp>
+#include <span>
+#include <vector>
+
+namespace scf::eigen_solver {
+namespace detail {
+
+// Extracts the element centers of a tensor, regardless of its float type
+struct CenterKernel {
+    template<typename FloatType>
+    std::vector<double> operator()(const std::span<FloatType>& x) {
+        using tensorwrapper::types::uq_center;
+        std::vector<double> rv(x.size());
+        for(std::size_t i = 0; i < x.size(); ++i) {
+            rv[i] = static_cast<double>(uq_center(x[i]));
+        }
+        return rv;
+    }
+};
+
+} // namespace detail
+
+/** @brief Returns the (row-major) element centers of @p t as doubles.
+ *
+ *  Auxiliary inputs such as starting rotations or symmetry transforms only
+ *  need their values, not their uncertainties, and may be stored with a
+ *  different float type than the matrix they act on. This normalizes them.
+ *
+ *  @param[in] t The tensor to read. If @p t is empty, so is the result.
+ */
+inline std::vector<double> tensor_centers(const simde::type::tensor& t) {
+    if(t == simde::type::tensor{}) return {};
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    detail::CenterKernel kernel;
+    return visit_contiguous_buffer(kernel, make_contiguous(t.buffer()));
+}
+
+} // namespace scf::eigen_solver
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "eigen_solver.hpp"
+#include "jacobi_eigen_helpers.hpp"
+#include "tensor_centers.hpp"
+#include "warm_start.hpp"
+#include <limits>
+#include <simde/simde.hpp>
+
+namespace scf::eigen_solver {
+
+namespace {
+
+struct Kernel {
+    std::size_t m_n_rows;
+    std::size_t m_n_cols;
+    std::size_t m_n_sweeps;
+    std::vector<double> m_V0;
+
+    using tensor_t = simde::type::tensor;
+    using return_t = std::pair<tensor_t, tensor_t>;
+
+    Kernel(std::size_t n_rows, std::size_t n_cols, std::size_t n_sweeps,
+           std::vector<double> V0) :
+      m_n_rows(n_rows),
+      m_n_cols(n_cols),
+      m_n_sweeps(n_sweeps),
+      m_V0(std::move(V0)) {}
+
+    template<typename FloatType>
+    return_t operator()(const std::span<FloatType>& A) {
+        using clean_t = std::decay_t<FloatType>;
+        using value_t = detail::value_type<clean_t>;
+        const auto n  = m_n_rows;
+        if(m_n_rows != m_n_cols) {
+            throw std::runtime_error("TwoPhaseJacobi: matrix must be square");
+        }
+        const double tol =
+          value_t(10) * std::numeric_limits<value_t>::epsilon();
+
+        auto [evals, evecs] =
+          detail::two_phase_jacobi_eigen<clean_t>(A, n, tol, m_n_sweeps, m_V0);
+
+        using tensorwrapper::utilities::make_tensor;
+        auto values  = make_tensor({n}, evals);
+        auto vectors = make_tensor({n, n}, evecs);
+        return std::make_pair(values, vectors);
+    }
+};
+} // namespace
+
+using pt = simde::EigenSolve;
+
+const auto desc = R"(
+ Eigen Solve via two-phase Jacobi
+ ---------------------------------
+
+ Symmetric eigen solve intended for matrices with uncertain elements. The
+ matrix of element centers is first diagonalized in plain floating point. The
+ full matrix is then rotated into that eigenbasis and the (small) residual
+ off-diagonal elements are removed by a few cyclic Jacobi sweeps performed in
+ the matrix's native arithmetic, which propagates the uncertainty to the
+ eigenvalues and eigenvectors.
+
+ The cleanup sweeps are capped by the "cleanup sweeps" input; reaching the cap
+ is not an error.
+
+ If the optional "initial rotation" input is set (e.g., to the previous SCF
+ iteration's eigenvectors), the centers are diagonalized by Jacobi sweeps
+ starting from it instead of by a direct solve. If those sweeps do not
+ converge the guess is discarded and the direct solve is used.
+ )";
+
+MODULE_CTOR(TwoPhaseJacobi) {
+    description(desc);
+    satisfies_property_type<pt>();
+
+    add_input<std::size_t>("cleanup sweeps")
+      .set_default(std::size_t{2})
+      .set_description("Maximum number of Jacobi sweeps in the UQ phase");
+    add_input<simde::type::tensor>(initial_rotation_key)
+      .set_default(simde::type::tensor{})
+      .set_description("Optional starting guess for the eigenvectors");
+}
+
+MODULE_RUN(TwoPhaseJacobi) {
+    using tensor_t      = simde::type::tensor;
+    auto&& [A]          = pt::unwrap_inputs(inputs);
+    const auto n_sweeps = inputs.at("cleanup sweeps").value<std::size_t>();
+    const auto V0       = inputs.at(initial_rotation_key).value<tensor_t>();
+
+    using tensorwrapper::buffer::make_contiguous;
+    const auto& A_buffer = make_contiguous(A.buffer());
+    const auto& A_shape  = A_buffer.shape();
+    Kernel k(A_shape.extent(0), A_shape.extent(1), n_sweeps,
+             tensor_centers(V0));
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    auto [values, vectors] = visit_contiguous_buffer(k, A_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, values, vectors);
+}
+
+} // namespace scf::eigen_solver
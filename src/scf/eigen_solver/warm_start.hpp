@@ -0,0 +1,153 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <pluginplay/pluginplay.hpp>
+#include <simde/simde.hpp>
+#include <span>
+#include <string>
+#include <tensorwrapper/buffer/contiguous.hpp>
+#include <type_traits>
+
+namespace scf::eigen_solver {
+
+/// Input key for the starting rotation of a normal eigen solve
+inline const std::string initial_rotation_key = "initial rotation";
+
+/// Input key for the previous eigenvectors of a generalized eigen solve
+inline const std::string initial_guess_key = "initial guess";
+
+/** @brief Whether a warm start under @p key can change what @p mod does.
+ *
+ *  A module can only use a warm start if it has the input @p key. Modules
+ *  which consume the warm start themselves (e.g., Jacobi solvers) have no
+ *  submodules. Modules with submodules (e.g., the generalized solver and the
+ *  Eigen Solve driver) only forward it, as "initial rotation", so they use
+ *  it if at least one of their submodules does. Callers can skip building a
+ *  warm start which would be ignored anyway.
+ *
+ *  @param[in] mod The module which would receive the warm start.
+ *  @param[in] key The name of the warm-start input of @p mod.
+ */
+inline bool uses_warm_start(const pluginplay::Module& mod,
+                            const std::string& key) {
+    if(!mod.inputs().count(key)) return false;
+    const auto& submods = mod.submods();
+    if(submods.empty()) return true;
+    for(const auto& [name, submod] : submods) {
+        if(!submod.has_module()) continue;
+        if(uses_warm_start(submod.value(), initial_rotation_key)) return true;
+    }
+    return false;
+}
+
+/// The Eigen Solve driver's backend submodule for elements of type @p T
+template<typename T>
+constexpr const char* eigen_backend_key() {
+    if constexpr(tensorwrapper::types::is_uncertain_v<T>) {
+        return "uncertain";
+    } else if constexpr(tensorwrapper::types::is_uq_type_v<T>) {
+        return "interval";
+    } else {
+        return "none";
+    }
+}
+
+/// The Eigen Solve driver's backend submodule for the elements of @p A
+inline const char* eigen_backend_key(const simde::type::tensor& A) {
+    struct Visitor {
+        template<typename FloatType>
+        const char* operator()(const std::span<FloatType>&) {
+            return eigen_backend_key<std::decay_t<FloatType>>();
+        }
+    };
+    using tensorwrapper::buffer::make_contiguous;
+    const auto& buffer = make_contiguous(A.buffer());
+    return tensorwrapper::buffer::visit_contiguous_buffer(Visitor{}, buffer);
+}
+
+/** @brief Whether a warm start under @p key can change what @p mod does when
+ *         it is run on the matrix @p A.
+ *
+ *  Same as uses_warm_start(mod, key), except that a module which routes by
+ *  floating-point type (the Eigen Solve driver, recognized by its "none",
+ *  "uncertain", and "interval" submodules) only counts the backend it would
+ *  actually select for @p A. E.g., for plain double matrices the default
+ *  driver runs the direct Eigen backend and the warm start is not used even
+ *  though the uncertain backend would accept it.
+ */
+inline bool uses_warm_start(const pluginplay::Module& mod,
+                            const std::string& key,
+                            const simde::type::tensor& A) {
+    if(!mod.inputs().count(key)) return false;
+    const auto& submods = mod.submods();
+    if(submods.empty()) return true;
+    const bool routes_by_type = submods.count("none") &&
+                                submods.count("uncertain") &&
+                                submods.count("interval");
+    if(routes_by_type) {
+        const auto& backend = submods.at(eigen_backend_key(A));
+        return backend.has_module() &&
+               uses_warm_start(backend.value(), initial_rotation_key, A);
+    }
+    for(const auto& [name, submod] : submods) {
+        if(!submod.has_module()) continue;
+        if(uses_warm_start(submod.value(), initial_rotation_key, A))
+            return true;
+    }
+    return false;
+}
+
+/// uses_warm_start() for the module behind @p submod
+inline bool uses_warm_start(const pluginplay::SubmoduleRequest& submod,
+                            const std::string& key) {
+    return submod.has_module() && uses_warm_start(submod.value(), key);
+}
+
+/** @brief Runs @p submod, forwarding a warm-start tensor when possible.
+ *
+ *  Eigen solvers may optionally accept a warm start (e.g., the eigenvectors
+ *  from the previous SCF iteration) through a module input named @p key. The
+ *  property types do not know about this input, so this function wraps the
+ *  property type inputs, sets @p key to @p V0, and runs the submodule. If
+ *  @p V0 is the default (empty) tensor or the submodule would not use it
+ *  (see uses_warm_start()), only the property type inputs are set, so the
+ *  memoized result does not depend on an ignored input.
+ *
+ *  @tparam PropertyType The property type to run @p submod as.
+ *
+ *  @param[in] submod The submodule to run.
+ *  @param[in] key The name of the warm-start input.
+ *  @param[in] V0 The warm-start tensor.
+ *  @param[in] args The inputs for @p PropertyType.
+ *
+ *  @return The results of @p PropertyType.
+ */
+template<typename PropertyType, typename... Args>
+auto run_with_warm_start(pluginplay::SubmoduleRequest& submod,
+                         const std::string& key, const simde::type::tensor& V0,
+                         Args&&... args) {
+    const auto& mod_inputs = submod.value().inputs();
+    auto inputs =
+      PropertyType::wrap_inputs(mod_inputs, std::forward<Args>(args)...);
+    if(V0 != simde::type::tensor{} && uses_warm_start(submod.value(), key)) {
+        inputs.at(key).change(V0);
+    }
+    auto results = submod.run(inputs);
+    return PropertyType::unwrap_results(results);
+}
+
+} // namespace scf::eigen_solver
@@ -15,6 +15,7 @@
  */
 
 #include "fock_operator.hpp"
+#include "../xc/gauxc/gauxc.hpp"
 #include "fock_operator_common.hpp"
 
 namespace scf::fock_operator {
@@ -37,12 +38,18 @@ public:
         if(*m_prho_ == DensityType{}) return;
         using j_type  = Coulomb<ElectronType, DensityType>;
         using xc_type = ExchangeCorrelation<ElectronType, DensityType>;
+        using k_type  = Exchange<ElectronType, DensityType>;
 
         const auto& electrons = this->get_e_(V_ee);
         auto j                = std::make_unique<j_type>(electrons, *m_prho_);
         auto xc = std::make_unique<xc_type>(m_func_, electrons, *m_prho_);
         this->m_pF_->emplace_back(2.0, std::move(j));
         this->m_pF_->emplace_back(1.0, std::move(xc));
+
+        const auto alpha = xc::gauxc::exact_exchange_fraction(m_func_);
+        if(alpha == 0.0) return;
+        auto k = std::make_unique<k_type>(electrons, *m_prho_);
+        this->m_pF_->emplace_back(-alpha, std::move(k));
     }
 
 private:
@@ -61,8 +68,13 @@ repulsion. The electron-electron repulsion is mapped to 2J + X where J is the
 Coulomb operator for the electrons interacting with a density and X is the
 exchange-correlation potential for the same density.
 
+For hybrid functionals (e.g., B3LYP and PBE0) V_ee is instead mapped to
+2J + X - aK, where K is the exchange operator for the density and a is the
+functional's fraction of exact exchange, as reported by ExchCXX. X then only
+holds the semilocal part of the functional.
+
 N.b. Empty densities are treated as zero densities and this module will skip
-adding 2J + X if provided an empty density.
+adding 2J + X (- aK) if provided an empty density.
 )";
 
 template<typename DensityType, typename ElectronType>
@@ -0,0 +1,243 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <simde/simde.hpp>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace scf::guess {
+
+/** @brief Hash of the shells of one atom's basis set.
+ *
+ *  Covers the angular momenta, purity, exponents, and coefficients of the
+ *  shells, but not the center, so every atom of an element carrying the same
+ *  basis hashes the same. Unlike std::hash the value is the same on every
+ *  platform and build (64-bit FNV-1a over the raw bytes), so it can be
+ *  stored on disk.
+ */
+template<typename AtomicBasisType>
+std::uint64_t atomic_basis_hash(const AtomicBasisType& atomic_bs) {
+    std::uint64_t seed = 0xcbf29ce484222325ULL;
+    auto hash_bytes    = [&seed](const auto& x) {
+        unsigned char bytes[sizeof(std::remove_reference_t<decltype(x)>)];
+        std::memcpy(bytes, &x, sizeof(x));
+        for(auto b : bytes) {
+            seed ^= b;
+            seed *= 0x100000001b3ULL;
+        }
+    };
+
+    hash_bytes(std::uint64_t(atomic_bs.size()));
+    for(std::size_t s = 0; s < atomic_bs.size(); ++s) {
+        const auto shell = atomic_bs[s];
+        hash_bytes(std::uint64_t(shell.l()));
+        hash_bytes(std::uint8_t(shell.pure() == chemist::ShellType::pure));
+        hash_bytes(std::uint64_t(shell.n_primitives()));
+        for(std::size_t p = 0; p < shell.n_primitives(); ++p) {
+            const auto prim = shell.primitive(p);
+            hash_bytes(double(prim.exponent()));
+            hash_bytes(double(prim.coefficient()));
+        }
+    }
+    return seed;
+}
+
+/** @brief Process-wide library of SAD atomic density matrices.
+ *
+ *  An atomic density only depends on the element and on the atom's basis
+ *  set, so it is computed once and reused for every molecule (and every
+ *  guess) afterwards. Entries are keyed by the atomic number and
+ *  atomic_basis_hash() of the atom's basis set. Each entry is the row-major
+ *  density matrix of the isolated atom in its own AO basis.
+ *
+ *  The library lives in memory and can be merged with, and written back to, a
+ *  binary file, so it also persists across processes. The file is written in
+ *  the host's byte order and is not meant to be moved between architectures.
+ *  All members are thread safe.
+ */
+class AtomicDensityCache {
+public:
+    /// (atomic number, basis set hash)
+    using key_type = std::pair<std::uint32_t, std::uint64_t>;
+
+    /// Row-major n by n density matrix of one atom
+    using block_type = std::vector<double>;
+
+    /// The process-wide instance
+    static AtomicDensityCache& instance() {
+        static AtomicDensityCache cache;
+        return cache;
+    }
+
+    /// Returns a copy of the density for @p key, if there is one
+    std::optional<block_type> find(const key_type& key) const {
+        std::lock_guard lock(m_mutex_);
+        auto itr = m_entries_.find(key);
+        if(itr == m_entries_.end()) return std::nullopt;
+        return itr->second;
+    }
+
+    /// Stores @p block under @p key, unless @p key is already present
+    void insert(const key_type& key, block_type block) {
+        std::lock_guard lock(m_mutex_);
+        m_entries_.emplace(key, std::move(block));
+    }
+
+    /// Number of cached atomic densities
+    std::size_t size() const {
+        std::lock_guard lock(m_mutex_);
+        return m_entries_.size();
+    }
+
+    /// Removes every entry (the file, if any, is left untouched)
+    void clear() {
+        std::lock_guard lock(m_mutex_);
+        m_entries_.clear();
+    }
+
+    /** @brief Adds the entries stored in @p path.
+     *
+     *  Entries which are already in memory are kept. A missing file is not
+     *  an error (the library is then simply not extended).
+     *
+     *  @throw std::runtime_error if @p path exists but is not a valid file.
+     */
+    void load(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        if(!file) return;
+
+        auto fail = [&]() {
+            throw std::runtime_error("AtomicDensityCache: " + path.string() +
+                                     " is not an atomic density file");
+        };
+        auto read = [&](auto& x) {
+            if(!file.read(reinterpret_cast<char*>(&x), sizeof(x))) fail();
+        };
+
+        std::array<char, 8> magic;
+        read(magic);
+        if(magic != file_magic) fail();
+
+        std::uint64_t n_entries;
+        read(n_entries);
+        std::map<key_type, block_type> entries;
+        for(std::uint64_t e = 0; e < n_entries; ++e) {
+            key_type key;
+            std::uint64_t n;
+            read(key.first);
+            read(key.second);
+            read(n);
+            block_type block(n * n);
+            const auto n_bytes = block.size() * sizeof(double);
+            if(!file.read(reinterpret_cast<char*>(block.data()), n_bytes))
+                fail();
+            entries.emplace(key, std::move(block));
+        }
+
+        std::lock_guard lock(m_mutex_);
+        m_entries_.merge(entries);
+    }
+
+    /** @brief Writes every entry to @p path.
+     *
+     *  The data goes to a uniquely named temporary file (mkstemp) next to
+     *  @p path, which is then renamed, so concurrent readers never see a
+     *  partially written file and concurrent writers never share one.
+     *
+     *  @throw std::runtime_error if the file can not be written.
+     */
+    void save(const std::filesystem::path& path) const {
+        std::string bytes;
+        auto write = [&](const auto& x) {
+            bytes.append(reinterpret_cast<const char*>(&x), sizeof(x));
+        };
+        {
+            std::lock_guard lock(m_mutex_);
+            write(file_magic);
+            write(std::uint64_t(m_entries_.size()));
+            for(const auto& [key, block] : m_entries_) {
+                write(key.first);
+                write(key.second);
+                write(std::uint64_t(block_dimension_(block)));
+                bytes.append(reinterpret_cast<const char*>(block.data()),
+                             block.size() * sizeof(double));
+            }
+        }
+
+        auto dir = path.parent_path();
+        if(dir.empty()) dir = ".";
+        auto tmp_name = (dir / path.filename()).string() + ".XXXXXX";
+        std::vector<char> tmp_path(tmp_name.begin(), tmp_name.end());
+        tmp_path.push_back('\0');
+
+        auto fail = [&](const std::string& what) {
+            throw std::runtime_error("AtomicDensityCache: could not " + what +
+                                     " " + tmp_path.data());
+        };
+        const int fd = ::mkstemp(tmp_path.data());
+        if(fd < 0) fail("create");
+
+        // mkstemp creates the file owner-only, the library is meant to be
+        // shared
+        ::fchmod(fd, 0644);
+        std::size_t n_written = 0;
+        while(n_written < bytes.size()) {
+            const auto rv = ::write(fd, bytes.data() + n_written,
+                                    bytes.size() - n_written);
+            if(rv < 0 && errno == EINTR) continue;
+            if(rv <= 0) break;
+            n_written += std::size_t(rv);
+        }
+        const bool ok = (::close(fd) == 0) && n_written == bytes.size();
+        if(!ok) {
+            ::unlink(tmp_path.data());
+            fail("write");
+        }
+        std::filesystem::rename(tmp_path.data(), path);
+    }
+
+private:
+    static constexpr std::array<char, 8> file_magic{'S', 'C', 'F', 'S',
+                                                    'A', 'D', '0', '1'};
+
+    static std::size_t block_dimension_(const block_type& block) {
+        std::size_t n = 0;
+        while(n * n < block.size()) ++n;
+        return n;
+    }
+
+    mutable std::mutex m_mutex_;
+    std::map<key_type, block_type> m_entries_;
+};
+
+} // namespace scf::guess
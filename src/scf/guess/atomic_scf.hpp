@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace scf::guess {
+
+/** @brief Spatial-orbital occupations of a spherically averaged atom.
+ *
+ *  Orbitals are filled in order of increasing energy. Orbitals whose
+ *  energies lie within @p degeneracy_tol of each other form a shell, and the
+ *  electrons of a partially filled shell are spread evenly over all of its
+ *  orbitals, which keeps the density spherical (and the guess independent of
+ *  the orientation of the atom).
+ *
+ *  @param[in] energies The orbital energies, in increasing order.
+ *  @param[in] n_electrons The number of electrons to place.
+ *  @param[in] degeneracy_tol Energy difference below which orbitals are
+ *                            treated as degenerate.
+ *
+ *  @return The occupation of each orbital divided by two, i.e., a number in
+ *          [0, 1] such that the density is sum_i w_i c_i c_i^T.
+ *
+ *  @throw std::runtime_error if there are not enough orbitals.
+ */
+template<typename VectorType>
+std::vector<double> fractional_occupations(const VectorType& energies,
+                                           double n_electrons,
+                                           double degeneracy_tol = 1.0E-4) {
+    const auto n = static_cast<std::size_t>(energies.size());
+    std::vector<double> w(n, 0.0);
+    double remaining = n_electrons / 2.0;
+    for(std::size_t i = 0; i < n && remaining > 0.0;) {
+        auto j = i + 1;
+        while(j < n && energies[j] - energies[i] < degeneracy_tol) ++j;
+        const double n_shell = double(j - i);
+        const double filled  = std::min(remaining, n_shell);
+        for(auto k = i; k < j; ++k) w[k] = filled / n_shell;
+        remaining -= filled;
+        i = j;
+    }
+    if(remaining > 1.0E-12)
+        throw std::runtime_error("Too few orbitals for the atom's electrons");
+    return w;
+}
+
+/** @brief Density matrix of an isolated atom from a restricted SCF.
+ *
+ *  Iterates F = H + 2J[P] - K[P] to self consistency with the fractional,
+ *  spherically averaged occupations of fractional_occupations(), starting
+ *  from the core Hamiltonian. Linear dependencies in the basis set are
+ *  removed by canonical orthogonalization. Densities of successive
+ *  iterations are mixed (damped), which is slower than extrapolation but
+ *  robust for the open shells that are typical of isolated atoms. If the SCF
+ *  has not converged after @p max_iter iterations the last density is
+ *  returned, which is still a fine guess.
+ *
+ *  @param[in] S The row-major n by n overlap matrix.
+ *  @param[in] H The row-major n by n core Hamiltonian.
+ *  @param[in] eri The row-major n^4 electron repulsion integrals (mn|ls).
+ *  @param[in] n The number of AOs on the atom.
+ *  @param[in] n_electrons The number of electrons of the atom.
+ *  @param[in] max_iter The maximum number of iterations.
+ *  @param[in] tol Convergence threshold on the largest density change.
+ *
+ *  @return The row-major n by n density P = sum_i w_i c_i c_i^T.
+ */
+inline std::vector<double> atomic_scf_density(const std::vector<double>& S,
+                                              const std::vector<double>& H,
+                                              const std::vector<double>& eri,
+                                              std::size_t n,
+                                              double n_electrons,
+                                              std::size_t max_iter = 200,
+                                              double tol           = 1.0E-8) {
+    using matrix_type =
+      Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    using map_type = Eigen::Map<const matrix_type>;
+    const auto n_       = static_cast<Eigen::Index>(n);
+    const matrix_type s = map_type(S.data(), n_, n_);
+    const matrix_type h = map_type(H.data(), n_, n_);
+
+    // X = U s^(-1/2) over the non-negligible eigenvalues of S
+    Eigen::SelfAdjointEigenSolver<matrix_type> s_solver(s);
+    const auto& s_values = s_solver.eigenvalues();
+    Eigen::Index n_dropped = 0;
+    while(n_dropped < n_ && s_values[n_dropped] < 1.0E-8) ++n_dropped;
+    const auto n_kept = n_ - n_dropped;
+    matrix_type X     = s_solver.eigenvectors().rightCols(n_kept);
+    for(Eigen::Index k = 0; k < n_kept; ++k)
+        X.col(k) /= std::sqrt(s_values[n_dropped + k]);
+
+    auto density = [&](const matrix_type& F) {
+        const matrix_type F_prime = X.transpose() * F * X;
+        Eigen::SelfAdjointEigenSolver<matrix_type> solver(F_prime);
+        const matrix_type C = X * solver.eigenvectors();
+        const auto& e       = solver.eigenvalues();
+        const auto w        = fractional_occupations(e, n_electrons);
+        matrix_type P       = matrix_type::Zero(n_, n_);
+        for(Eigen::Index i = 0; i < n_kept; ++i) {
+            if(w[i] == 0.0) continue;
+            P.noalias() += w[i] * C.col(i) * C.col(i).transpose();
+        }
+        return P;
+    };
+
+    auto fock = [&](const matrix_type& P) {
+        matrix_type F = h;
+        for(std::size_t m = 0; m < n; ++m) {
+            for(std::size_t v = 0; v <= m; ++v) {
+                double g = 0.0;
+                for(std::size_t l = 0; l < n; ++l) {
+                    for(std::size_t s = 0; s < n; ++s) {
+                        const double j = eri[((m * n + v) * n + l) * n + s];
+                        const double k = eri[((m * n + l) * n + v) * n + s];
+                        g += P(l, s) * (2.0 * j - k);
+                    }
+                }
+                F(m, v) += g;
+                if(v != m) F(v, m) += g;
+            }
+        }
+        return F;
+    };
+
+    constexpr double damping = 0.5;
+    matrix_type P            = density(h);
+    for(std::size_t iter = 0; iter < max_iter; ++iter) {
+        const matrix_type P_new = density(fock(P));
+        const double change     = (P_new - P).cwiseAbs().maxCoeff();
+        P = damping * P + (1.0 - damping) * P_new;
+        if(change < tol) break;
+    }
+    return std::vector<double>(P.data(), P.data() + n * n);
+}
+
+} // namespace scf::guess
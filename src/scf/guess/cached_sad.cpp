@@ -0,0 +1,203 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../utilities/block_sparse_matrix.hpp"
+#include "../utilities/parallel_for.hpp"
+#include "atomic_density_cache.hpp"
+#include "atomic_scf.hpp"
+#include "guess.hpp"
+#include "guess_common.hpp"
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace scf::guess {
+namespace {
+const auto desc = R"(
+Cached SAD Guess
+----------------
+
+Superposition of atomic densities assembled from a process-wide library of
+atomic densities keyed by element and atomic basis set (see
+AtomicDensityCache). After the first molecule containing an element/basis
+pair the guess density costs nothing more than copying blocks onto the
+diagonal. The Fock operator is then built for that density and its orbitals
+are the guess.
+
+Elements missing from the library are solved with a spherically averaged,
+fractionally occupied atomic SCF. The integrals of each atom come from the
+"Atomic integrals" and "ERI4" submodules, after which the atomic SCFs run
+concurrently on up to "max threads" threads. If "atomic density file" is not
+empty the library is read from that file first and written back whenever new
+elements were added, which shares it between processes.
+)";
+
+using cache_type = AtomicDensityCache;
+
+} // namespace
+
+using rscf_wf    = simde::type::rscf_wf;
+using density_t  = simde::type::decomposable_e_density;
+using pt         = simde::InitialGuess<rscf_wf>;
+using fock_op_pt = simde::FockOperator<density_t>;
+using update_pt  = simde::UpdateGuess<rscf_wf>;
+using ao_pt      = simde::aos_op_base_aos;
+using eri_pt     = simde::ERI4;
+
+using simde::type::tensor;
+
+namespace {
+
+// The integrals an atomic SCF needs, for the atom's basis only
+struct AtomicProblem {
+    cache_type::key_type key;
+    std::size_t n_aos;
+    double n_electrons;
+    std::vector<double> S, H, eri;
+};
+
+template<typename AtomicBasisType>
+AtomicProblem atomic_problem(const AtomicBasisType& atomic_bs,
+                             pluginplay::type::submodule_map& submods) {
+    using braket_type =
+      simde::type::braket<simde::type::aos, simde::type::op_base_type,
+                          simde::type::aos>;
+
+    const auto Z = atomic_bs.atomic_number().value();
+    const auto& r = atomic_bs.center();
+    simde::type::nuclei atom{
+      simde::type::nucleus("X", Z, 1.0, r.x(), r.y(), r.z())};
+    simde::type::ao_basis_set bs;
+    bs.add_center(atomic_bs);
+    simde::type::aos aos(bs);
+
+    auto& ao_mod = submods.at("Atomic integrals");
+    auto matrix  = [&](const auto& op) {
+        braket_type o_mn(aos, op, aos);
+        return to_doubles(ao_mod.run_as<ao_pt>(o_mn));
+    };
+
+    AtomicProblem rv;
+    rv.key         = {std::uint32_t(Z), atomic_basis_hash(atomic_bs)};
+    rv.n_aos       = atomic_bs.n_aos();
+    rv.n_electrons = double(Z);
+    rv.S           = matrix(simde::type::s_e_type{});
+    simde::type::electron e;
+    rv.H   = matrix(simde::type::t_e_type(e));
+    auto V = matrix(simde::type::v_en_type(e, atom));
+    for(std::size_t i = 0; i < V.size(); ++i) rv.H[i] += V[i];
+
+    simde::type::aos_squared aos2(aos, aos);
+    simde::type::v_ee_type v_ee;
+    chemist::braket::BraKet mnls(aos2, v_ee, aos2);
+    rv.eri = to_doubles(submods.at("ERI4").run_as<eri_pt>(mnls));
+    return rv;
+}
+
+// Block-diagonal density of the molecule from the cached atomic densities,
+// solving (concurrently) for the atoms which are not in the cache yet
+simde::type::tensor cached_sad_density(const simde::type::aos& aos,
+                                       pluginplay::type::submodule_map& submods,
+                                       const std::string& file,
+                                       std::size_t n_threads) {
+    auto& cache = cache_type::instance();
+    if(!file.empty()) cache.load(file);
+
+    const auto& bs = aos.ao_basis_set();
+    std::vector<cache_type::key_type> keys;
+    for(std::size_t c = 0; c < bs.size(); ++c) {
+        const auto Z = bs[c].atomic_number().value();
+        keys.emplace_back(std::uint32_t(Z), atomic_basis_hash(bs[c]));
+    }
+
+    // Integrals are evaluated serially (modules are not thread safe), one
+    // center per missing element/basis pair
+    std::vector<AtomicProblem> problems;
+    std::set<cache_type::key_type> queued;
+    for(std::size_t c = 0; c < bs.size(); ++c) {
+        if(cache.find(keys[c]) || !queued.insert(keys[c]).second) continue;
+        problems.push_back(atomic_problem(bs[c], submods));
+    }
+
+    auto solve = [&](std::size_t begin, std::size_t end) {
+        for(auto i = begin; i < end; ++i) {
+            const auto& p = problems[i];
+            cache.insert(p.key, atomic_scf_density(p.S, p.H, p.eri, p.n_aos,
+                                                   p.n_electrons));
+        }
+    };
+    utilities::parallel_for(problems.size(), solve, n_threads);
+    if(!file.empty() && !problems.empty()) cache.save(file);
+
+    const auto offsets = utilities::atom_offsets(bs);
+    const auto n       = offsets.back();
+    std::vector<double> P(n * n, 0.0);
+    for(std::size_t c = 0; c < bs.size(); ++c) {
+        const auto block = cache.find(keys[c]).value();
+        const auto r0    = offsets[c];
+        const auto n_c   = offsets[c + 1] - r0;
+        for(std::size_t i = 0; i < n_c; ++i)
+            std::copy_n(block.data() + i * n_c, n_c,
+                        P.data() + (r0 + i) * n + r0);
+    }
+
+    using tensorwrapper::utilities::make_tensor;
+    return make_tensor({n, n}, P);
+}
+
+} // namespace
+
+MODULE_CTOR(CachedSAD) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<fock_op_pt>("Build Fock operator");
+    add_submodule<update_pt>("Guess updater");
+    add_submodule<ao_pt>("Atomic integrals");
+    add_submodule<eri_pt>("ERI4");
+
+    add_input<std::string>("atomic density file")
+      .set_default(std::string{})
+      .set_description("File the atomic density cache is read from and "
+                       "saved to (empty keeps it in memory only)");
+    add_input<std::size_t>("max threads")
+      .set_default(std::size_t{0})
+      .set_description("Maximum number of concurrent atomic SCFs (0 means "
+                       "all hardware threads)");
+}
+
+MODULE_RUN(CachedSAD) {
+    const auto&& [H, aos] = pt::unwrap_inputs(inputs);
+    const auto file  = inputs.at("atomic density file").value<std::string>();
+    const auto n_thr = inputs.at("max threads").value<std::size_t>();
+
+    // Step 1: Build Fock Operator with the cached SAD density
+    simde::type::cmos cmos(tensor{}, aos, tensor{});
+    auto P = cached_sad_density(aos, submods, file, n_thr);
+    density_t rho(std::move(P), cmos);
+    auto& fock_op_mod = submods.at("Build Fock operator");
+    const auto& f     = fock_op_mod.run_as<fock_op_pt>(H, rho);
+
+    // Step 2: Get number of electrons and occupations
+    rscf_wf zero_guess(aufbau_occupations(H), cmos);
+    auto& update_mod = submods.at("Guess updater");
+    const auto& Psi0 = update_mod.run_as<update_pt>(f, zero_guess);
+
+    auto rv = results();
+    return pt::wrap_results(rv, Psi0);
+}
+
+} // namespace scf::guess
@@ -15,6 +15,7 @@
  */
 
 #include "guess.hpp"
+#include "guess_common.hpp"
 
 namespace scf::guess {
 namespace {
@@ -34,34 +35,6 @@ using update_pt  = simde::UpdateGuess<rscf_wf>;
 
 using simde::type::tensor;
 
-// TODO: move to chemist?
-struct NElectronCounter : public chemist::qm_operator::OperatorVisitor {
-    NElectronCounter() : chemist::qm_operator::OperatorVisitor(false) {}
-
-    void run(const simde::type::T_e_type& T_e) {
-        set_n(T_e.get_particle().size());
-    }
-
-    void run(const simde::type::V_en_type& V_en) {
-        set_n(V_en.get_lhs_particle().size());
-    }
-
-    void run(const simde::type::V_ee_type& V_ee) {
-        set_n(V_ee.get_lhs_particle().size());
-        set_n(V_ee.get_rhs_particle().size());
-    }
-
-    void set_n(unsigned int n) {
-        if(n_electrons == 0)
-            n_electrons = n;
-        else if(n_electrons != n) {
-            throw std::runtime_error("Deduced a different number of electrons");
-        }
-    }
-
-    unsigned int n_electrons = 0;
-};
-
 MODULE_CTOR(Core) {
     description(desc);
     satisfies_property_type<pt>();
@@ -79,17 +52,7 @@ MODULE_RUN(Core) {
 
     // Step 2: Get number of electrons and occupations
     simde::type::cmos cmos(tensor{}, aos, tensor{});
-    NElectronCounter visitor;
-    H.visit(visitor);
-    auto n_electrons = visitor.n_electrons;
-    if(n_electrons % 2 != 0)
-        throw std::runtime_error("Assumed even number of electrons");
-
-    typename rscf_wf::orbital_index_set_type occs;
-    using value_type = typename rscf_wf::orbital_index_set_type::value_type;
-    for(value_type i = 0; i < n_electrons / 2; ++i) occs.insert(i);
-
-    rscf_wf zero_guess(occs, cmos);
+    rscf_wf zero_guess(aufbau_occupations(H), cmos);
     auto& update_mod = submods.at("Guess updater");
     const auto& Psi0 = update_mod.run_as<update_pt>(f, zero_guess);
 
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../utilities/block_sparse_matrix.hpp"
+#include "../utilities/parallel_for.hpp"
+#include "atomic_scf.hpp"
+#include "fragments.hpp"
+#include "guess.hpp"
+#include "guess_common.hpp"
+#include <stdexcept>
+#include <vector>
+
+namespace scf::guess {
+namespace {
+const auto desc = R"(
+Fragment Guess
+--------------
+
+Guess for molecular clusters and solvated systems, built from the densities
+of the isolated fragments of the system:
+
+#. The atoms are partitioned into fragments. By default the fragments are
+   the covalently bonded molecules (atoms closer than 1.3 times the sum of
+   their covalent radii are bonded); "fragments" may instead list the atoms
+   (by index of their center in the AO basis set) of each fragment.
+   Fragments are neutral unless "fragment charges" says otherwise.
+#. The integrals of each fragment, in the AOs on its atoms, come from the
+   "Two center evaluator" and "ERI4" submodules. Evaluating them is serial
+   (modules are not thread safe), after which the restricted SCFs of the
+   fragments run concurrently on up to "max threads" threads. Degenerate
+   frontier orbitals of open-shell fragments are occupied fractionally.
+#. The fragment densities are placed on the diagonal of the density of the
+   system. If "purification steps" is not zero, the assembled density is
+   McWeeny purified with the overlap of the whole system.
+#. The Fock operator is built for that density and the "Guess updater"
+   submodule turns it into the guess orbitals.
+
+The module satisfies InitialGuess, so it can be used as the "Guess"
+submodule of the SCF driver.
+)";
+
+} // namespace
+
+using rscf_wf    = simde::type::rscf_wf;
+using density_t  = simde::type::decomposable_e_density;
+using pt         = simde::InitialGuess<rscf_wf>;
+using fock_op_pt = simde::FockOperator<density_t>;
+using update_pt  = simde::UpdateGuess<rscf_wf>;
+using ao_pt      = simde::aos_op_base_aos;
+using eri_pt     = simde::ERI4;
+
+using simde::type::tensor;
+
+namespace {
+
+using fragment_list = std::vector<fragment_type>;
+
+// The integrals of one fragment's SCF, for the AOs on its atoms only
+struct FragmentProblem {
+    std::vector<std::size_t> ao_indices;
+    double n_electrons;
+    std::vector<double> S, H, eri;
+};
+
+FragmentProblem fragment_problem(const simde::type::ao_basis_set& full_bs,
+                                 const utilities::block_offsets& offsets,
+                                 const fragment_type& atoms, int charge,
+                                 pluginplay::type::submodule_map& submods) {
+    using braket_type =
+      simde::type::braket<simde::type::aos, simde::type::op_base_type,
+                          simde::type::aos>;
+
+    FragmentProblem rv;
+    rv.n_electrons = -double(charge);
+    simde::type::nuclei nuclei;
+    simde::type::ao_basis_set bs;
+    for(auto c : atoms) {
+        const auto Z  = full_bs[c].atomic_number().value();
+        const auto& r = full_bs[c].center();
+        nuclei.push_back(
+          simde::type::nucleus("X", Z, 1.0, r.x(), r.y(), r.z()));
+        bs.add_center(full_bs[c]);
+        rv.n_electrons += double(Z);
+        for(auto mu = offsets[c]; mu < offsets[c + 1]; ++mu)
+            rv.ao_indices.push_back(mu);
+    }
+    if(rv.n_electrons < 0.0)
+        throw std::runtime_error("Fragment has a negative number of electrons");
+    simde::type::aos aos(bs);
+
+    auto& ao_mod = submods.at("Two center evaluator");
+    auto matrix  = [&](const auto& op) {
+        braket_type o_mn(aos, op, aos);
+        return to_doubles(ao_mod.run_as<ao_pt>(o_mn));
+    };
+
+    rv.S = matrix(simde::type::s_e_type{});
+    simde::type::electron e;
+    rv.H   = matrix(simde::type::t_e_type(e));
+    auto V = matrix(simde::type::v_en_type(e, nuclei));
+    for(std::size_t i = 0; i < V.size(); ++i) rv.H[i] += V[i];
+
+    simde::type::aos_squared aos2(aos, aos);
+    simde::type::v_ee_type v_ee;
+    chemist::braket::BraKet mnls(aos2, v_ee, aos2);
+    rv.eri = to_doubles(submods.at("ERI4").run_as<eri_pt>(mnls));
+    return rv;
+}
+
+fragment_list default_fragments(const simde::type::ao_basis_set& bs) {
+    std::vector<std::array<double, 3>> r;
+    std::vector<unsigned int> Z;
+    for(std::size_t c = 0; c < bs.size(); ++c) {
+        const auto& center = bs[c].center();
+        r.push_back({center.x(), center.y(), center.z()});
+        Z.push_back(bs[c].atomic_number().value());
+    }
+    return bonded_fragments(r, Z);
+}
+
+} // namespace
+
+MODULE_CTOR(Fragment) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<ao_pt>("Two center evaluator");
+    add_submodule<eri_pt>("ERI4");
+    add_submodule<fock_op_pt>("Build Fock operator");
+    add_submodule<update_pt>("Guess updater");
+
+    add_input<fragment_list>("fragments")
+      .set_default(fragment_list{})
+      .set_description("The atoms of each fragment (empty means one fragment "
+                       "per covalently bonded molecule)");
+    add_input<std::vector<int>>("fragment charges")
+      .set_default(std::vector<int>{})
+      .set_description("The charge of each fragment (empty means all "
+                       "fragments are neutral)");
+    add_input<std::size_t>("purification steps")
+      .set_default(std::size_t{0})
+      .set_description("Number of McWeeny purification steps applied to the "
+                       "assembled density");
+    add_input<std::size_t>("max threads")
+      .set_default(std::size_t{0})
+      .set_description("Maximum number of concurrent fragment SCFs (0 means "
+                       "all hardware threads)");
+}
+
+MODULE_RUN(Fragment) {
+    const auto&& [H, aos] = pt::unwrap_inputs(inputs);
+    auto fragments = inputs.at("fragments").value<fragment_list>();
+    auto charges   = inputs.at("fragment charges").value<std::vector<int>>();
+    const auto n_purify = inputs.at("purification steps").value<std::size_t>();
+    const auto n_thr    = inputs.at("max threads").value<std::size_t>();
+
+    // Step 1: Partition the system
+    const auto& bs = aos.ao_basis_set();
+    if(fragments.empty()) fragments = default_fragments(bs);
+    check_partition(fragments, bs.size());
+    if(charges.empty()) charges.assign(fragments.size(), 0);
+    if(charges.size() != fragments.size())
+        throw std::runtime_error("Need one charge per fragment");
+
+    // Step 2: Fragment integrals (serially), then fragment SCFs (concurrently)
+    const auto offsets = utilities::atom_offsets(bs);
+    std::vector<FragmentProblem> problems;
+    double n_electrons = 0.0;
+    for(std::size_t f = 0; f < fragments.size(); ++f) {
+        problems.push_back(
+          fragment_problem(bs, offsets, fragments[f], charges[f], submods));
+        n_electrons += problems.back().n_electrons;
+    }
+    NElectronCounter counter;
+    H.visit(counter);
+    if(n_electrons != double(counter.n_electrons))
+        throw std::runtime_error(
+          "Fragment charges do not add up to the charge of the system");
+
+    std::vector<std::vector<double>> densities(problems.size());
+    auto solve = [&](std::size_t begin, std::size_t end) {
+        for(auto f = begin; f < end; ++f) {
+            const auto& p = problems[f];
+            densities[f]  = atomic_scf_density(p.S, p.H, p.eri,
+                                               p.ao_indices.size(),
+                                               p.n_electrons);
+        }
+    };
+    utilities::parallel_for(problems.size(), solve, n_thr);
+
+    // Step 3: Block-diagonal density, optionally purified
+    const auto n = offsets.back();
+    std::vector<double> P(n * n, 0.0);
+    for(std::size_t f = 0; f < problems.size(); ++f) {
+        const auto& mu  = problems[f].ao_indices;
+        const auto n_f  = mu.size();
+        const auto& P_f = densities[f];
+        for(std::size_t i = 0; i < n_f; ++i)
+            for(std::size_t j = 0; j < n_f; ++j)
+                P[mu[i] * n + mu[j]] = P_f[i * n_f + j];
+    }
+    if(n_purify > 0) {
+        using braket_type =
+          simde::type::braket<simde::type::aos, simde::type::op_base_type,
+                              simde::type::aos>;
+        braket_type s_mn(aos, simde::type::s_e_type{}, aos);
+        auto& ao_mod = submods.at("Two center evaluator");
+        const auto S = to_doubles(ao_mod.run_as<ao_pt>(s_mn));
+        P            = mcweeny_purify(P, S, n, n_purify);
+    }
+
+    // Step 4: Fock operator of the assembled density and its orbitals
+    using tensorwrapper::utilities::make_tensor;
+    simde::type::cmos cmos(tensor{}, aos, tensor{});
+    density_t rho(make_tensor({n, n}, P), cmos);
+    auto& fock_op_mod = submods.at("Build Fock operator");
+    const auto& f     = fock_op_mod.run_as<fock_op_pt>(H, rho);
+
+    rscf_wf zero_guess(aufbau_occupations(H), cmos);
+    auto& update_mod = submods.at("Guess updater");
+    const auto& Psi0 = update_mod.run_as<update_pt>(f, zero_guess);
+
+    auto rv = results();
+    return pt::wrap_results(rv, Psi0);
+}
+
+} // namespace scf::guess
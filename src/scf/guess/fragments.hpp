@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace scf::guess {
+
+/// Indices of the atoms in one fragment, in increasing order
+using fragment_type = std::vector<std::size_t>;
+
+/** @brief Covalent radius of element @p Z, in bohr.
+ *
+ *  Values are those of Cordero et al. (Dalton Trans. 2008, 2832) for H-Kr.
+ *  Heavier elements get 1.5 angstrom, which is about the size of their
+ *  single-bond radii.
+ */
+inline double covalent_radius(unsigned int Z) {
+    // Angstrom, indexed by Z - 1
+    static constexpr std::array<double, 36> radii{
+      0.31, 0.28, 1.28, 0.96, 0.84, 0.76, 0.71, 0.66, 0.57, 0.58, 1.66, 1.41,
+      1.21, 1.11, 1.07, 1.05, 1.02, 1.06, 2.03, 1.76, 1.70, 1.60, 1.53, 1.39,
+      1.39, 1.32, 1.26, 1.24, 1.32, 1.22, 1.22, 1.20, 1.19, 1.20, 1.20, 1.16};
+    constexpr double angstrom_to_bohr = 1.0 / 0.529177210903;
+    const double r = (Z >= 1 && Z <= radii.size()) ? radii[Z - 1] : 1.5;
+    return r * angstrom_to_bohr;
+}
+
+/** @brief Splits a system into its covalently bonded molecules.
+ *
+ *  Atoms i and j are bonded if they are closer than @p scale times the sum
+ *  of their covalent radii, and the fragments are the connected components
+ *  of the resulting graph. Fragments are ordered by their lowest atom index.
+ *
+ *  @param[in] r The Cartesian coordinates of the atoms (bohr).
+ *  @param[in] Z The atomic numbers of the atoms.
+ *  @param[in] scale Tolerance on the bond lengths.
+ *
+ *  @throw std::runtime_error if @p r and @p Z differ in length.
+ */
+inline std::vector<fragment_type> bonded_fragments(
+  const std::vector<std::array<double, 3>>& r,
+  const std::vector<unsigned int>& Z, double scale = 1.3) {
+    const auto n = r.size();
+    if(Z.size() != n)
+        throw std::runtime_error("Need one atomic number per atom");
+
+    // Union-find over the atoms, with path halving
+    std::vector<std::size_t> parent(n);
+    std::iota(parent.begin(), parent.end(), std::size_t{0});
+    auto root = [&](std::size_t i) {
+        while(parent[i] != i) i = parent[i] = parent[parent[i]];
+        return i;
+    };
+    for(std::size_t i = 0; i < n; ++i) {
+        for(std::size_t j = 0; j < i; ++j) {
+            const double bond = scale * (covalent_radius(Z[i]) +
+                                         covalent_radius(Z[j]));
+            double r2 = 0.0;
+            for(std::size_t q = 0; q < 3; ++q)
+                r2 += (r[i][q] - r[j][q]) * (r[i][q] - r[j][q]);
+            if(r2 < bond * bond) parent[root(i)] = root(j);
+        }
+    }
+
+    // Atoms are visited in order, so fragments come out sorted
+    std::vector<fragment_type> rv;
+    std::vector<std::size_t> fragment_of(n, n);
+    for(std::size_t i = 0; i < n; ++i) {
+        auto& f = fragment_of[root(i)];
+        if(f == n) {
+            f = rv.size();
+            rv.emplace_back();
+        }
+        rv[f].push_back(i);
+    }
+    return rv;
+}
+
+/** @brief Checks that @p fragments partition the atoms [0, @p n_atoms).
+ *
+ *  @throw std::runtime_error if a fragment is empty, or if an atom is out of
+ *                            range, in no fragment, or in more than one.
+ */
+inline void check_partition(const std::vector<fragment_type>& fragments,
+                            std::size_t n_atoms) {
+    std::vector<bool> seen(n_atoms, false);
+    std::size_t n_seen = 0;
+    for(const auto& f : fragments) {
+        if(f.empty()) throw std::runtime_error("Fragments can not be empty");
+        for(auto i : f) {
+            if(i >= n_atoms || seen[i])
+                throw std::runtime_error(
+                  "Fragments must contain each atom exactly once");
+            seen[i] = true;
+            ++n_seen;
+        }
+    }
+    if(n_seen != n_atoms)
+        throw std::runtime_error(
+          "Fragments must contain each atom exactly once");
+}
+
+/** @brief McWeeny purification of a density in a non-orthogonal basis.
+ *
+ *  Each step maps P to 3 P S P - 2 P S P S P, which drives the eigenvalues
+ *  of P S towards 0 and 1 (quadratically, once they are close) while
+ *  keeping the number of electrons if P S is already near idempotent.
+ *
+ *  @param[in] P The row-major n by n density, normalized so that
+ *               tr(P S) is the number of electron pairs.
+ *  @param[in] S The row-major n by n overlap matrix.
+ *  @param[in] n The number of AOs.
+ *  @param[in] n_steps The number of purification steps.
+ *
+ *  @return The purified, row-major density.
+ */
+inline std::vector<double> mcweeny_purify(const std::vector<double>& P,
+                                          const std::vector<double>& S,
+                                          std::size_t n, std::size_t n_steps) {
+    using matrix_type =
+      Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    using map_type = Eigen::Map<const matrix_type>;
+    const auto n_  = static_cast<Eigen::Index>(n);
+    matrix_type p  = map_type(P.data(), n_, n_);
+    const map_type s(S.data(), n_, n_);
+    for(std::size_t step = 0; step < n_steps; ++step) {
+        const matrix_type ps  = p * s;
+        const matrix_type psp = ps * p;
+        p = 3.0 * psp - 2.0 * ps * psp;
+        // Round-off makes p slowly drift away from being symmetric
+        p = 0.5 * (p + p.transpose()).eval();
+    }
+    return std::vector<double>(p.data(), p.data() + n * n);
+}
+
+} // namespace scf::guess
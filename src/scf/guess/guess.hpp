@@ -21,10 +21,20 @@ namespace scf::guess {
 
 DECLARE_MODULE(Core);
 DECLARE_MODULE(SAD);
+DECLARE_MODULE(CachedSAD);
+DECLARE_MODULE(SAP);
+DECLARE_MODULE(GWH);
+DECLARE_MODULE(Projection);
+DECLARE_MODULE(Fragment);
 
 inline void load_modules(pluginplay::ModuleManager& mm) {
     mm.add_module<Core>("Core guess");
     mm.add_module<SAD>("SAD guess");
+    mm.add_module<CachedSAD>("Cached SAD guess");
+    mm.add_module<SAP>("SAP guess");
+    mm.add_module<GWH>("GWH guess");
+    mm.add_module<Projection>("Projection guess");
+    mm.add_module<Fragment>("Fragment guess");
 }
 
 inline void set_defaults(pluginplay::ModuleManager& mm) {
@@ -37,6 +47,40 @@ inline void set_defaults(pluginplay::ModuleManager& mm) {
                      "Restricted One-Electron Fock Op");
     mm.change_submod("SAD guess", "Guess updater",
                      "Diagonalization Fock update");
+
+    mm.change_submod("Cached SAD guess", "Build Fock operator",
+                     "Restricted One-Electron Fock Op");
+    mm.change_submod("Cached SAD guess", "Guess updater",
+                     "Diagonalization Fock update");
+    mm.change_submod("Cached SAD guess", "Atomic integrals",
+                     "SCF integral driver");
+
+    mm.change_submod("SAP guess", "Two center evaluator",
+                     "SCF integral driver");
+    mm.change_submod("SAP guess", "AOs on a grid", "AOs on a grid");
+    mm.change_submod("SAP guess", "Diagonalizer",
+                     "Generalized eigensolve via Eigen");
+
+    mm.change_submod("GWH guess", "Two center evaluator",
+                     "SCF integral driver");
+    mm.change_submod("GWH guess", "Diagonalizer",
+                     "Generalized eigensolve via Eigen");
+
+    const auto projection = "Projection guess";
+    mm.change_submod(projection, "Small basis guess", "Core guess");
+    mm.change_submod(projection, "Small basis optimizer", "Loop");
+    mm.change_submod(projection, "Two center evaluator", "SCF integral driver");
+    mm.change_submod(projection, "Build Fock operator",
+                     "Restricted One-Electron Fock Op");
+    mm.change_submod(projection, "Guess updater",
+                     "Diagonalization Fock update");
+
+    mm.change_submod("Fragment guess", "Two center evaluator",
+                     "SCF integral driver");
+    mm.change_submod("Fragment guess", "Build Fock operator",
+                     "Restricted One-Electron Fock Op");
+    mm.change_submod("Fragment guess", "Guess updater",
+                     "Diagonalization Fock update");
 }
 
 } // namespace scf::guess
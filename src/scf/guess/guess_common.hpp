@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <simde/simde.hpp>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace scf::guess {
+
+// TODO: move to chemist?
+struct NElectronCounter : public chemist::qm_operator::OperatorVisitor {
+    NElectronCounter() : chemist::qm_operator::OperatorVisitor(false) {}
+
+    void run(const simde::type::T_e_type& T_e) {
+        set_n(T_e.get_particle().size());
+    }
+
+    void run(const simde::type::V_en_type& V_en) {
+        set_n(V_en.get_lhs_particle().size());
+    }
+
+    void run(const simde::type::V_ee_type& V_ee) {
+        set_n(V_ee.get_lhs_particle().size());
+        set_n(V_ee.get_rhs_particle().size());
+    }
+
+    void set_n(unsigned int n) {
+        if(n_electrons == 0)
+            n_electrons = n;
+        else if(n_electrons != n) {
+            throw std::runtime_error("Deduced a different number of electrons");
+        }
+    }
+
+    unsigned int n_electrons = 0;
+};
+
+/** @brief The closed-shell aufbau occupations for Hamiltonian @p H.
+ *
+ *  The number of electrons is deduced from the terms of @p H and the lowest
+ *  n_electrons / 2 orbitals are occupied.
+ *
+ *  @throw std::runtime_error if the number of electrons is odd.
+ */
+inline auto aufbau_occupations(const simde::type::hamiltonian& H) {
+    using rscf_wf = simde::type::rscf_wf;
+    NElectronCounter visitor;
+    H.visit(visitor);
+    auto n_electrons = visitor.n_electrons;
+    if(n_electrons % 2 != 0)
+        throw std::runtime_error("Assumed even number of electrons");
+
+    typename rscf_wf::orbital_index_set_type occs;
+    using value_type = typename rscf_wf::orbital_index_set_type::value_type;
+    for(value_type i = 0; i < n_electrons / 2; ++i) occs.insert(i);
+    return occs;
+}
+
+namespace detail {
+
+struct ToDoubles {
+    template<typename FloatType>
+    std::vector<double> operator()(const std::span<FloatType>& x) {
+        using clean_t = std::decay_t<FloatType>;
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error(
+              "This guess requires double-precision integrals");
+        } else {
+            return std::vector<double>(x.begin(), x.end());
+        }
+    }
+};
+
+} // namespace detail
+
+/// Copies the elements of a double-precision tensor, in row-major order
+inline std::vector<double> to_doubles(const simde::type::tensor& t) {
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& buffer = make_contiguous(t.buffer());
+    return visit_contiguous_buffer(detail::ToDoubles{}, buffer);
+}
+
+} // namespace scf::guess
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "guess.hpp"
+#include "guess_common.hpp"
+#include "huckel_parameters.hpp"
+
+namespace scf::guess {
+namespace {
+const auto desc = R"(
+GWH Guess
+---------
+
+Generalized Wolfsberg-Helmholz (extended Hückel) guess. An approximate Fock
+matrix is built from the overlap matrix S alone,
+
+.. math::
+
+   F_{mm} = -I_m, \qquad F_{mn} = \frac{K}{2} S_{mn} (F_{mm} + F_{nn}),
+
+where I_m is the valence ionization potential of the subshell AO m belongs
+to (see ao_ionization_potentials) and K is "Wolfsberg-Helmholz constant". The
+guess orbitals are the solutions of F C = S C e from the "Diagonalizer"
+submodule, i.e., the same generalized eigenproblem the "Diagonalization Fock
+update" solves. Apart from S (from the "Two center evaluator" submodule) no
+integrals are needed, and in particular no Fock build.
+)";
+
+} // namespace
+
+using rscf_wf         = simde::type::rscf_wf;
+using pt              = simde::InitialGuess<rscf_wf>;
+using ao_pt           = simde::aos_op_base_aos;
+using diagonalizer_pt = simde::GeneralizedEigenSolve;
+
+MODULE_CTOR(GWH) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<ao_pt>("Two center evaluator");
+    add_submodule<diagonalizer_pt>("Diagonalizer");
+
+    add_input<double>("Wolfsberg-Helmholz constant")
+      .set_default(1.75)
+      .set_description("Scales the off-diagonal elements of the Fock matrix");
+}
+
+MODULE_RUN(GWH) {
+    using braket_type =
+      simde::type::braket<simde::type::aos, simde::type::op_base_type,
+                          simde::type::aos>;
+
+    const auto&& [H, aos] = pt::unwrap_inputs(inputs);
+    const auto K = inputs.at("Wolfsberg-Helmholz constant").value<double>();
+    const auto& bs = aos.ao_basis_set();
+
+    // Step 1: S
+    auto& ao_mod = submods.at("Two center evaluator");
+    braket_type s_mn(aos, simde::type::s_e_type{}, aos);
+    const auto S      = ao_mod.run_as<ao_pt>(s_mn);
+    const auto S_data = to_doubles(S);
+
+    // Step 2: Diagonal from the ionization potentials, off-diagonal by GWH
+    std::vector<double> h;
+    for(std::size_t c = 0; c < bs.size(); ++c) {
+        const auto ips = ao_ionization_potentials(bs[c]);
+        for(auto ip : ips) h.push_back(-ip);
+    }
+    const auto n = h.size();
+    std::vector<double> F(n * n);
+    for(std::size_t m = 0; m < n; ++m) {
+        for(std::size_t v = 0; v < n; ++v) {
+            const auto s = S_data[m * n + v];
+            F[m * n + v] = m == v ? h[m] : 0.5 * K * s * (h[m] + h[v]);
+        }
+    }
+
+    // Step 3: Diagonalize once
+    using tensorwrapper::utilities::make_tensor;
+    const auto F_matrix    = make_tensor({n, n}, F);
+    auto& diagonalizer_mod = submods.at("Diagonalizer");
+    const auto&& [evalues, evectors] =
+      diagonalizer_mod.run_as<diagonalizer_pt>(F_matrix, S);
+
+    simde::type::cmos cmos(evalues, aos, evectors);
+    rscf_wf Psi0(aufbau_occupations(H), cmos);
+
+    auto rv = results();
+    return pt::wrap_results(rv, Psi0);
+}
+
+} // namespace scf::guess
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace scf::guess {
+
+/// One subshell of an electron configuration: n, l, and its occupation
+struct Subshell {
+    int n;
+    int l;
+    int occupation;
+};
+
+/** @brief The aufbau ground-state configuration of a neutral atom.
+ *
+ *  Subshells are filled in Madelung (n + l, then n) order with 2(2l + 1)
+ *  electrons each. The handful of exceptions to the rule (e.g., Cr and Cu)
+ *  are ignored, which is immaterial for a guess.
+ *
+ *  @throw std::runtime_error if @p Z is not in [1, 118].
+ */
+inline std::vector<Subshell> aufbau_configuration(int Z) {
+    if(Z < 1 || Z > 118)
+        throw std::runtime_error("Atomic number out of range");
+
+    std::vector<Subshell> order;
+    for(int n = 1; n <= 7; ++n)
+        for(int l = 0; l < n && l <= 3; ++l) order.push_back({n, l, 0});
+    std::sort(order.begin(), order.end(), [](const auto& a, const auto& b) {
+        return a.n + a.l != b.n + b.l ? a.n + a.l < b.n + b.l : a.n < b.n;
+    });
+
+    std::vector<Subshell> rv;
+    for(auto shell : order) {
+        if(Z == 0) break;
+        shell.occupation = std::min(Z, 2 * (2 * shell.l + 1));
+        Z -= shell.occupation;
+        rv.push_back(shell);
+    }
+    return rv;
+}
+
+/** @brief Orbital energy (hartree) of subshell (n, l) of atom Z by Slater's
+ *         rules.
+ *
+ *  Z_eff = Z - s, where s screens the electron by 0.35 per other electron
+ *  in its own group (0.30 within 1s); an s or p electron is further
+ *  screened by 0.85 per electron of shell n - 1 and by 1 per electron of
+ *  lower shells, a d or f electron by 1 per electron of every group to its
+ *  left. The energy is then -(Z_eff / n*)^2 / 2 with Slater's effective
+ *  principal quantum number n*. The subshell need not be occupied, in which
+ *  case the energy is that of one added electron (and 0 if such an electron
+ *  would be completely screened).
+ */
+inline double slater_orbital_energy(int Z, int n, int l) {
+    // Slater's groups: [1s][2s,2p][3s,3p][3d][4s,4p][4d][4f]...
+    auto group = [](int n_i, int l_i) { return 4 * n_i + std::max(l_i, 1); };
+    const auto target = group(n, l);
+
+    double s = 0.0;
+    for(const auto& shell : aufbau_configuration(Z)) {
+        const auto g = group(shell.n, shell.l);
+        double n_e   = shell.occupation;
+        if(shell.n == n && shell.l == l) n_e -= 1.0;
+        if(g == target) {
+            s += n_e * (n == 1 ? 0.30 : 0.35);
+        } else if(g < target) {
+            if(l >= 2 || shell.n <= n - 2)
+                s += n_e;
+            else if(shell.n == n - 1)
+                s += 0.85 * n_e;
+        }
+    }
+
+    constexpr std::array<double, 8> n_star{0.0, 1.0, 2.0, 3.0,
+                                           3.7, 4.0, 4.2, 4.2};
+    const double z_eff = std::max(Z - s, 0.0);
+    const double ratio = z_eff / n_star.at(n);
+    return -0.5 * ratio * ratio;
+}
+
+/** @brief Valence-state ionization potential (hartree) of (n, l) for Z.
+ *
+ *  Tabulated for the valence s and p subshells of H through Ar (the
+ *  customary extended-Hückel parameters, from atomic spectra). Returns
+ *  nothing for other subshells and elements.
+ */
+inline std::optional<double> tabulated_ionization_potential(int Z, int n,
+                                                            int l) {
+    constexpr double ev_per_hartree = 27.211386245988;
+    // (s, p) VSIPs in eV; 0 means not tabulated
+    constexpr std::array<std::array<double, 2>, 19> vsip{{
+      {0.0, 0.0},   // (no element 0)
+      {13.6, 0.0},  // H
+      {24.6, 0.0},  // He
+      {5.4, 3.5},   // Li
+      {10.0, 6.0},  // Be
+      {15.2, 8.5},  // B
+      {21.4, 11.4}, // C
+      {26.0, 13.4}, // N
+      {32.3, 14.8}, // O
+      {40.0, 18.1}, // F
+      {48.5, 21.6}, // Ne
+      {5.1, 3.0},   // Na
+      {9.0, 4.5},   // Mg
+      {12.3, 6.5},  // Al
+      {17.3, 9.2},  // Si
+      {18.6, 14.0}, // P
+      {20.0, 11.0}, // S
+      {26.3, 14.2}, // Cl
+      {29.2, 15.8}  // Ar
+    }};
+    if(Z < 1 || Z >= int(vsip.size()) || l > 1) return std::nullopt;
+    const int valence_n = Z <= 2 ? 1 : Z <= 10 ? 2 : 3;
+    if(n != valence_n) return std::nullopt;
+    const double ip = vsip[Z][l];
+    if(ip == 0.0) return std::nullopt;
+    return ip / ev_per_hartree;
+}
+
+/** @brief Ionization potential (hartree) assigned to each AO of an atom.
+ *
+ *  The shells of @p atomic_bs are assigned subshells (n, l) in order: the
+ *  k-th shell of angular momentum l (k = 0, 1, ...) is subshell
+ *  n = l + 1 + k, except that shells beyond the outermost occupied subshell
+ *  of their l (e.g., the extra functions of split-valence basis sets) are
+ *  treated as that outermost subshell. Each subshell gets its tabulated
+ *  valence ionization potential if there is one and minus its Slater-rule
+ *  orbital energy otherwise.
+ */
+template<typename AtomicBasisType>
+std::vector<double> ao_ionization_potentials(const AtomicBasisType& atomic_bs) {
+    const int Z       = atomic_bs.atomic_number().value();
+    const auto config = aufbau_configuration(Z);
+    std::array<int, 8> n_max{};
+    for(const auto& shell : config) n_max.at(shell.l) = shell.n;
+
+    std::array<int, 16> n_seen{};
+    std::vector<double> rv;
+    for(std::size_t s = 0; s < atomic_bs.size(); ++s) {
+        const auto shell = atomic_bs[s];
+        const int l      = shell.l();
+        int n            = l + 1 + n_seen.at(l)++;
+        if(l < int(n_max.size()) && n_max[l] > 0) n = std::min(n, n_max[l]);
+
+        auto ip = tabulated_ionization_potential(Z, n, l);
+        const double value =
+          ip ? *ip : -slater_orbital_energy(Z, std::min(n, 7), l);
+        rv.insert(rv.end(), shell.size(), value);
+    }
+    return rv;
+}
+
+} // namespace scf::guess
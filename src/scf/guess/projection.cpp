@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../utilities/aos2molecule.hpp"
+#include "guess.hpp"
+#include "guess_common.hpp"
+#include <Eigen/Dense>
+
+namespace scf::guess {
+namespace {
+const auto desc = R"(
+Basis Set Projection Guess
+--------------------------
+
+Converges the SCF in a small basis set first and projects the result into
+the target basis set:
+
+#. The small basis set for the molecule is made by the "Small basis set"
+   submodule and the SCF is converged in it with the "Small basis guess"
+   and "Small basis optimizer" submodules.
+#. The occupied orbitals C_s are projected into the target basis,
+   C = S_bb^-1 S_bs C_s, where S_bb is the overlap of the target basis and
+   S_bs the mixed target/small basis overlap (both from the "Two center
+   evaluator" submodule).
+#. C is orthonormalized, C <- C (C^T S_bb C)^(-1/2), which makes
+   P = C C^T an idempotent density of the target basis.
+#. The Fock operator is built for P and the "Guess updater" submodule turns
+   it into the guess orbitals.
+
+All SCF iterations but one Fock build hence happen in the small basis.
+)";
+
+} // namespace
+
+using rscf_wf    = simde::type::rscf_wf;
+using density_t  = simde::type::decomposable_e_density;
+using pt         = simde::InitialGuess<rscf_wf>;
+using fock_op_pt = simde::FockOperator<density_t>;
+using update_pt  = simde::UpdateGuess<rscf_wf>;
+using ao_pt      = simde::aos_op_base_aos;
+using basis_pt   = simde::MolecularBasisSet;
+using h_braket_t =
+  chemist::braket::BraKet<rscf_wf, simde::type::hamiltonian, rscf_wf>;
+using egy_pt = simde::EvaluateBraKet<h_braket_t>;
+using opt_pt = simde::Optimize<egy_pt, rscf_wf>;
+
+using simde::type::tensor;
+
+MODULE_CTOR(Projection) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<basis_pt>("Small basis set");
+    add_submodule<pt>("Small basis guess");
+    add_submodule<opt_pt>("Small basis optimizer");
+    add_submodule<ao_pt>("Two center evaluator");
+    add_submodule<fock_op_pt>("Build Fock operator");
+    add_submodule<update_pt>("Guess updater");
+}
+
+MODULE_RUN(Projection) {
+    using matrix_type =
+      Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    using map_type = Eigen::Map<const matrix_type>;
+    using braket_type =
+      simde::type::braket<simde::type::aos, simde::type::op_base_type,
+                          simde::type::aos>;
+
+    const auto&& [H, aos] = pt::unwrap_inputs(inputs);
+
+    // Step 1: SCF in the small basis set
+    const auto mol  = utilities::aos2molecule(aos.ao_basis_set());
+    auto& basis_mod = submods.at("Small basis set");
+    simde::type::aos small_aos(basis_mod.run_as<basis_pt>(mol));
+
+    auto& guess_mod   = submods.at("Small basis guess");
+    const auto& psi_0 = guess_mod.run_as<pt>(H, small_aos);
+    h_braket_t H_00(psi_0, H, psi_0);
+    auto& opt_mod             = submods.at("Small basis optimizer");
+    const auto&& [e_s, psi_s] = opt_mod.run_as<opt_pt>(H_00, psi_0);
+
+    // Step 2: Project the occupied orbitals, C = S_bb^-1 S_bs C_s
+    auto& ao_mod = submods.at("Two center evaluator");
+    braket_type s_bb(aos, simde::type::s_e_type{}, aos);
+    braket_type s_bs(aos, simde::type::s_e_type{}, small_aos);
+    const auto S_bb_data = to_doubles(ao_mod.run_as<ao_pt>(s_bb));
+    const auto S_bs_data = to_doubles(ao_mod.run_as<ao_pt>(s_bs));
+    const auto C_s_data  = to_doubles(psi_s.orbitals().transform());
+
+    using index_t   = Eigen::Index;
+    const auto n_b  = static_cast<index_t>(aos.ao_basis_set().n_aos());
+    const auto n_s  = static_cast<index_t>(small_aos.ao_basis_set().n_aos());
+    const auto n_mo = static_cast<index_t>(C_s_data.size()) / n_s;
+    map_type S_bb(S_bb_data.data(), n_b, n_b);
+    map_type S_bs(S_bs_data.data(), n_b, n_s);
+    map_type C_s(C_s_data.data(), n_s, n_mo);
+
+    const auto& occs = psi_s.orbital_indices();
+    matrix_type C_occ(n_s, index_t(occs.size()));
+    index_t col = 0;
+    for(auto i : occs) C_occ.col(col++) = C_s.col(index_t(i));
+
+    const matrix_type C = S_bb.ldlt().solve(S_bs * C_occ);
+
+    // Step 3: Orthonormalize, C <- C M^(-1/2) with M = C^T S_bb C
+    const matrix_type M = C.transpose() * S_bb * C;
+    Eigen::SelfAdjointEigenSolver<matrix_type> m_solver(M);
+    const matrix_type C_orth = C * m_solver.operatorInverseSqrt();
+    const matrix_type P      = C_orth * C_orth.transpose();
+
+    // Step 4: One Fock build in the target basis, then the guess orbitals
+    using tensorwrapper::utilities::make_tensor;
+    const auto n = static_cast<std::size_t>(n_b);
+    std::vector<double> P_data(P.data(), P.data() + n * n);
+    simde::type::cmos cmos(tensor{}, aos, tensor{});
+    density_t rho(make_tensor({n, n}, P_data), cmos);
+    auto& fock_op_mod = submods.at("Build Fock operator");
+    const auto& f     = fock_op_mod.run_as<fock_op_pt>(H, rho);
+
+    rscf_wf zero_guess(aufbau_occupations(H), cmos);
+    auto& update_mod = submods.at("Guess updater");
+    const auto& Psi0 = update_mod.run_as<update_pt>(f, zero_guess);
+
+    auto rv = results();
+    return pt::wrap_results(rv, Psi0);
+}
+
+} // namespace scf::guess
@@ -15,6 +15,7 @@
  */
 
 #include "guess.hpp"
+#include "guess_common.hpp"
 
 namespace scf::guess {
 namespace {
@@ -22,7 +23,13 @@ const auto desc = R"(
 SAD Guess
 ---------
 
-TODO: Write me!!!
+Superposition of atomic densities. The density of the molecule is taken to
+be the block-diagonal sum of the densities of its isolated atoms, as returned
+by the "SAD Density" submodule. The Fock operator is built for that density
+and its orbitals are the guess.
+
+See "Cached SAD guess" for a variant which computes the atomic densities for
+the basis set actually in use and reuses them between molecules.
 )";
 }
 
@@ -35,34 +42,6 @@ using initial_rho_pt = simde::InitialDensity;
 
 using simde::type::tensor;
 
-// TODO: move to chemist?
-struct NElectronCounter : public chemist::qm_operator::OperatorVisitor {
-    NElectronCounter() : chemist::qm_operator::OperatorVisitor(false) {}
-
-    void run(const simde::type::T_e_type& T_e) {
-        set_n(T_e.get_particle().size());
-    }
-
-    void run(const simde::type::V_en_type& V_en) {
-        set_n(V_en.get_lhs_particle().size());
-    }
-
-    void run(const simde::type::V_ee_type& V_ee) {
-        set_n(V_ee.get_lhs_particle().size());
-        set_n(V_ee.get_rhs_particle().size());
-    }
-
-    void set_n(unsigned int n) {
-        if(n_electrons == 0)
-            n_electrons = n;
-        else if(n_electrons != n) {
-            throw std::runtime_error("Deduced a different number of electrons");
-        }
-    }
-
-    unsigned int n_electrons = 0;
-};
-
 MODULE_CTOR(SAD) {
     description(desc);
     satisfies_property_type<pt>();
@@ -74,7 +53,7 @@ MODULE_CTOR(SAD) {
 MODULE_RUN(SAD) {
     const auto&& [H, aos] = pt::unwrap_inputs(inputs);
 
-    // Step 1: Build Fock Operator with zero density
+    // Step 1: Build Fock Operator with the SAD density
     auto& initial_rho_mod = submods.at("SAD Density");
     const auto& rho       = initial_rho_mod.run_as<initial_rho_pt>(H);
     auto& fock_op_mod     = submods.at("Build Fock operator");
@@ -82,17 +61,7 @@ MODULE_RUN(SAD) {
 
     // Step 2: Get number of electrons and occupations
     simde::type::cmos cmos(tensor{}, aos, tensor{});
-    NElectronCounter visitor;
-    H.visit(visitor);
-    auto n_electrons = visitor.n_electrons;
-    if(n_electrons % 2 != 0)
-        throw std::runtime_error("Assumed even number of electrons");
-
-    typename rscf_wf::orbital_index_set_type occs;
-    using value_type = typename rscf_wf::orbital_index_set_type::value_type;
-    for(value_type i = 0; i < n_electrons / 2; ++i) occs.insert(i);
-
-    rscf_wf zero_guess(occs, cmos);
+    rscf_wf zero_guess(aufbau_occupations(H), cmos);
     auto& update_mod = submods.at("Guess updater");
     const auto& Psi0 = update_mod.run_as<update_pt>(f, zero_guess);
 
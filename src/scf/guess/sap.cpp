@@ -0,0 +1,202 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../utilities/block_sparse_matrix.hpp"
+#include "guess.hpp"
+#include "guess_common.hpp"
+#include "sap_potential.hpp"
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <simde/integration_grids/collocation_matrix.hpp>
+#include <vector>
+
+namespace scf::guess {
+namespace {
+const auto desc = R"(
+SAP Guess
+---------
+
+Superposition of atomic potentials. The guess orbitals are the eigenvectors
+of T + V_SAP, where T is the kinetic energy and V_SAP the sum of the
+screened potentials -Z_eff(r) / r of the neutral atoms (see
+sap_effective_charge). Unlike the core Hamiltonian, V_SAP includes the
+screening of each nucleus by its own electrons, so the orbitals have about
+the right size and ordering, and no two-electron integrals are needed.
+
+Each atom's contribution to V_SAP is integrated on a spherical grid centered
+on that atom, with "radial points" radial shells and an angular product
+rule of order "angular order". The AOs are evaluated on the grid with the
+"AOs on a grid" submodule, but only those that matter: the AOs of a center B
+whose most diffuse primitive falls below "screening threshold" at a distance
+R_B are taken to vanish beyond R_B, and they enter atom A's integral only if
+|V_A| reaches the threshold within R_B of B. Grid points farther than R_B
+from every such center are dropped too. For large systems each atom then
+costs a roughly constant number of AOs and points instead of all of them. A
+threshold of 0 keeps every AO and point.
+
+S and T come from the "Two center evaluator" submodule and the generalized
+eigenvalue problem is solved once with the "Diagonalizer" submodule.
+)";
+
+// Distance beyond which every primitive of @p atomic_bs is below @p thresh
+template<typename AtomicBasisType>
+double ao_extent(const AtomicBasisType& atomic_bs, double thresh) {
+    if(thresh <= 0.0) return std::numeric_limits<double>::infinity();
+    double alpha = std::numeric_limits<double>::infinity();
+    for(std::size_t s = 0; s < atomic_bs.size(); ++s) {
+        const auto shell = atomic_bs[s];
+        for(std::size_t p = 0; p < shell.n_primitives(); ++p)
+            alpha = std::min(alpha, double(shell.primitive(p).exponent()));
+    }
+    return std::sqrt(std::log(1.0 / thresh) / alpha);
+}
+
+} // namespace
+
+using rscf_wf         = simde::type::rscf_wf;
+using pt              = simde::InitialGuess<rscf_wf>;
+using ao_pt           = simde::aos_op_base_aos;
+using collocation_pt  = simde::AOCollocationMatrix;
+using diagonalizer_pt = simde::GeneralizedEigenSolve;
+
+MODULE_CTOR(SAP) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<ao_pt>("Two center evaluator");
+    add_submodule<collocation_pt>("AOs on a grid");
+    add_submodule<diagonalizer_pt>("Diagonalizer");
+
+    add_input<std::size_t>("radial points")
+      .set_default(std::size_t{50})
+      .set_description("Number of radial shells of each atomic grid");
+    add_input<std::size_t>("angular order")
+      .set_default(std::size_t{11})
+      .set_description("Number of polar angles of each atomic grid (twice "
+                       "as many azimuthal angles are used)");
+    add_input<double>("screening threshold")
+      .set_default(1.0E-6)
+      .set_description("AOs and grid points whose contributions to an "
+                       "atom's potential fall below this are neglected");
+}
+
+MODULE_RUN(SAP) {
+    using matrix_type =
+      Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    using map_type = Eigen::Map<const matrix_type>;
+    using braket_type =
+      simde::type::braket<simde::type::aos, simde::type::op_base_type,
+                          simde::type::aos>;
+
+    const auto&& [H, aos] = pt::unwrap_inputs(inputs);
+    const auto n_radial   = inputs.at("radial points").value<std::size_t>();
+    const auto n_theta    = inputs.at("angular order").value<std::size_t>();
+    const auto thresh     = inputs.at("screening threshold").value<double>();
+    const auto& bs        = aos.ao_basis_set();
+    const auto n          = static_cast<Eigen::Index>(bs.n_aos());
+
+    // Step 1: S and T
+    auto& ao_mod = submods.at("Two center evaluator");
+    braket_type s_mn(aos, simde::type::s_e_type{}, aos);
+    const auto S = ao_mod.run_as<ao_pt>(s_mn);
+    simde::type::electron e;
+    braket_type t_mn(aos, simde::type::t_e_type(e), aos);
+    const auto T_data = to_doubles(ao_mod.run_as<ao_pt>(t_mn));
+
+    // Step 2: V_SAP = sum_A <m|V_A|n>, each on a grid centered on atom A,
+    // over the AOs and grid points that are significant for A
+    const auto unit_grid = spherical_grid(n_radial, n_theta);
+    const auto offsets   = utilities::atom_offsets(bs);
+    std::vector<double> extent(bs.size());
+    for(std::size_t c = 0; c < bs.size(); ++c)
+        extent[c] = ao_extent(bs[c], thresh);
+    auto distance = [](const auto& r, double x, double y, double z) {
+        return std::hypot(r.x() - x, r.y() - y, r.z() - z);
+    };
+
+    auto& grid_mod = submods.at("AOs on a grid");
+    matrix_type V  = matrix_type::Zero(n, n);
+    for(std::size_t c = 0; c < bs.size(); ++c) {
+        const double Z = bs[c].atomic_number().value();
+        const auto& r  = bs[c].center();
+
+        // Centers whose AOs feel at least thresh of V_A, and their AOs
+        std::vector<std::size_t> centers;
+        std::vector<Eigen::Index> ao_index;
+        simde::type::ao_basis_set sub_bs;
+        for(std::size_t b = 0; b < bs.size(); ++b) {
+            const auto& r_b    = bs[b].center();
+            const double d     = distance(r, r_b.x(), r_b.y(), r_b.z());
+            const double d_min = d - extent[b];
+            if(d_min > 0.0 && sap_effective_charge(Z, d_min) / d_min < thresh)
+                continue;
+            centers.push_back(b);
+            sub_bs.add_center(bs[b]);
+            for(auto mu = offsets[b]; mu < offsets[b + 1]; ++mu)
+                ao_index.push_back(static_cast<Eigen::Index>(mu));
+        }
+
+        // Grid points within reach of at least one of those AOs
+        std::vector<chemist::GridPoint> points;
+        std::vector<double> wv;
+        for(const auto& [x, y, z, w] : unit_grid) {
+            const double px = r.x() + x, py = r.y() + y, pz = r.z() + z;
+            const bool reached =
+              std::any_of(centers.begin(), centers.end(), [&](auto b) {
+                  return distance(bs[b].center(), px, py, pz) <= extent[b];
+              });
+            if(!reached) continue;
+            const double d = std::sqrt(x * x + y * y + z * z);
+            wv.push_back(-w * sap_effective_charge(Z, d) / d);
+            points.emplace_back(w, px, py, pz);
+        }
+        if(points.empty()) continue;
+        chemist::Grid grid(points.begin(), points.end());
+
+        const auto n_sub    = static_cast<Eigen::Index>(ao_index.size());
+        const auto n_points = static_cast<Eigen::Index>(wv.size());
+        const auto& phi_t   = grid_mod.run_as<collocation_pt>(grid, sub_bs);
+        const auto phi_data = to_doubles(phi_t);
+        map_type phi(phi_data.data(), n_sub, n_points);
+        Eigen::Map<const Eigen::VectorXd> w_v(wv.data(), n_points);
+        const matrix_type V_c = phi * w_v.asDiagonal() * phi.transpose();
+        for(Eigen::Index i = 0; i < n_sub; ++i)
+            for(Eigen::Index j = 0; j < n_sub; ++j)
+                V(ao_index[i], ao_index[j]) += V_c(i, j);
+    }
+
+    // Step 3: Diagonalize T + V_SAP once
+    std::vector<double> F(T_data);
+    for(Eigen::Index m = 0; m < n; ++m)
+        for(Eigen::Index v = 0; v < n; ++v)
+            F[m * n + v] += 0.5 * (V(m, v) + V(v, m));
+
+    using tensorwrapper::utilities::make_tensor;
+    const auto n_aos       = static_cast<std::size_t>(n);
+    const auto F_matrix    = make_tensor({n_aos, n_aos}, F);
+    auto& diagonalizer_mod = submods.at("Diagonalizer");
+    const auto&& [evalues, evectors] =
+      diagonalizer_mod.run_as<diagonalizer_pt>(F_matrix, S);
+
+    simde::type::cmos cmos(evalues, aos, evectors);
+    rscf_wf Psi0(aufbau_occupations(H), cmos);
+
+    auto rv = results();
+    return pt::wrap_results(rv, Psi0);
+}
+
+} // namespace scf::guess
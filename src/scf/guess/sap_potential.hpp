@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace scf::guess {
+
+/** @brief Effective nuclear charge of a neutral atom's SAP at distance @p r.
+ *
+ *  The superposition-of-atomic-potentials guess needs the potential
+ *  V(r) = -Z_eff(r) / r of each (spherically averaged, neutral) atom. Here
+ *  Z_eff is the Thomas-Fermi screening of the nucleus, in Tietz's closed
+ *  form phi(x) = (1 + 0.53625 x)^-2 with x = r / (0.88534 Z^(-1/3)). Z_eff
+ *  goes from Z at the nucleus to 0 far away, so a neutral atom does not act
+ *  on distant electrons and V_SAP differs from the core Hamiltonian's -Z/r
+ *  at every distance, also for hydrogen.
+ *
+ *  @param[in] Z The atomic number.
+ *  @param[in] r The distance from the nucleus (bohr).
+ */
+inline double sap_effective_charge(double Z, double r) {
+    const double b   = 0.88534 / std::cbrt(Z);
+    const double phi = 1.0 / std::pow(1.0 + 0.53625 * r / b, 2);
+    return Z * phi;
+}
+
+/** @brief Nodes and weights of the n-point Gauss-Legendre rule on [-1, 1].
+ *
+ *  The nodes are found by Newton's method from the usual asymptotic
+ *  estimates and are returned in increasing order.
+ */
+inline std::pair<std::vector<double>, std::vector<double>> gauss_legendre(
+  std::size_t n) {
+    std::vector<double> x(n), w(n);
+    for(std::size_t i = 0; i < (n + 1) / 2; ++i) {
+        double z  = std::cos(M_PI * (i + 0.75) / (n + 0.5));
+        double dp = 0.0;
+        for(int iter = 0; iter < 100; ++iter) {
+            // P_n(z) and its derivative by the three-term recurrence
+            double p0 = 1.0, p1 = z;
+            for(std::size_t k = 2; k <= n; ++k) {
+                const double p2 = ((2.0 * k - 1.0) * z * p1 - (k - 1.0) * p0);
+                p0              = p1;
+                p1              = p2 / k;
+            }
+            dp              = n * (z * p1 - p0) / (z * z - 1.0);
+            const double dz = p1 / dp;
+            z -= dz;
+            if(std::fabs(dz) < 1.0E-15) break;
+        }
+        x[i]         = -z;
+        x[n - 1 - i] = z;
+        w[i] = w[n - 1 - i] = 2.0 / ((1.0 - z * z) * dp * dp);
+    }
+    return {std::move(x), std::move(w)};
+}
+
+/** @brief A spherical product grid centered on the origin.
+ *
+ *  The radial part is Becke's mapping r = R (1 + x) / (1 - x) of an
+ *  @p n_radial point Gauss-Chebyshev rule of the second kind, and the
+ *  angular part is a Gauss-Legendre rule of @p n_theta points in cos(theta)
+ *  times a 2 @p n_theta point trapezoidal rule in phi. The weights include
+ *  the volume element, so sum_p w_p f(r_p) approximates the integral of f
+ *  over all space. Angular polynomials of degree below 2 @p n_theta are
+ *  integrated exactly.
+ *
+ *  @return One (x, y, z, weight) tuple per point.
+ */
+inline std::vector<std::array<double, 4>> spherical_grid(
+  std::size_t n_radial, std::size_t n_theta, double R = 1.0) {
+    const auto [cos_theta, w_theta] = gauss_legendre(n_theta);
+    const auto n_phi                = 2 * n_theta;
+    const double w_phi              = 2.0 * M_PI / n_phi;
+
+    std::vector<std::array<double, 4>> grid;
+    grid.reserve(n_radial * n_theta * n_phi);
+    for(std::size_t i = 1; i <= n_radial; ++i) {
+        const double t     = i * M_PI / (n_radial + 1);
+        const double x     = std::cos(t);
+        const double r     = R * (1.0 + x) / (1.0 - x);
+        const double dr_dx = 2.0 * R / ((1.0 - x) * (1.0 - x));
+        // Gauss-Chebyshev (2nd kind) for int_{-1}^{1} f(x) dx
+        const double w_x = M_PI / (n_radial + 1) * std::sin(t);
+        const double w_r = w_x * dr_dx * r * r;
+        for(std::size_t j = 0; j < n_theta; ++j) {
+            const double cos_t = cos_theta[j];
+            const double sin_t = std::sqrt(1.0 - cos_t * cos_t);
+            for(std::size_t k = 0; k < n_phi; ++k) {
+                const double phi = k * w_phi;
+                grid.push_back({r * sin_t * std::cos(phi),
+                                r * sin_t * std::sin(phi), r * cos_t,
+                                w_r * w_theta[j] * w_phi});
+            }
+        }
+    }
+    return grid;
+}
+
+} // namespace scf::guess
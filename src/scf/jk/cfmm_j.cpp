@@ -0,0 +1,579 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef BUILD_TAMM_SCF
+#include "../utilities/libint_basis.hpp"
+#include "../utilities/parallel_for.hpp"
+#include "jk.hpp"
+#include "multipole_expansion.hpp"
+#include "setup_cache.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace scf::jk {
+namespace {
+
+const auto desc = R"(
+Continuous Fast Multipole Coulomb Matrix (CFMM-J)
+-------------------------------------------------
+
+Builds J in linear time for large systems by splitting the interactions
+between shell-pair charge distributions into a near and a far field.
+
+1. Every significant shell pair ab is given a center and an extent (the
+   distance beyond which its primitive products fall below "screening
+   threshold") and its Cartesian multipole integrals, up to "multipole
+   order", are computed about that center.
+2. The pairs are sorted into an octree with at most "leaf size" pairs per
+   leaf. Each box's radius covers the extents of the pairs in it.
+3. Density-weighted multipoles are accumulated up the tree. A dual traversal
+   of the tree sends the multipoles of box S to the local expansion of box T
+   whenever (r_T + r_S) < "opening angle" * |T - S|, i.e., whenever the two
+   boxes' charge distributions are well separated. The local expansions are
+   then translated down the tree.
+4. Each pair's far-field J is its multipoles contracted with the local
+   expansion of its leaf. The remaining, near-field, leaf pairs are
+   evaluated exactly with Schwarz and density screened four-center
+   integrals.
+
+P is assumed to be symmetric. Multipole integrals are available up to
+octupoles.
+
+Accuracy: each far-field interaction is a Taylor expansion truncated at total
+order "multipole order", so its relative error scales as
+"opening angle"^("multipole order" + 1). With octupoles, the default opening
+angle of 0.25 makes the far field about 16 times more accurate than 0.5
+(where errors of about 2e-4 in J were seen), at the cost of roughly 8 times
+as many exact near-field quartets. Lower it, or use an exact J builder, when
+J is needed more accurately.
+
+Steps 1 and 2, and the interaction lists of step 3, only depend on the basis
+set and the inputs above (not on P), so they are kept between calls and
+rebuilt only when one of those changes.
+)";
+
+using basis_type  = libint2::BasisSet;
+using point_type  = CartesianExpansion::point_type;
+using vector_type = CartesianExpansion::vector_type;
+
+constexpr unsigned max_multipole_order = 3;
+
+libint2::Operator multipole_operator(unsigned order) {
+    switch(order) {
+        case 0: return libint2::Operator::overlap;
+        case 1: return libint2::Operator::emultipole1;
+        case 2: return libint2::Operator::emultipole2;
+        default: return libint2::Operator::emultipole3;
+    }
+}
+
+double distance(const point_type& x, const point_type& y) {
+    return std::hypot(x[0] - y[0], x[1] - y[1], x[2] - y[2]);
+}
+
+point_type difference(const point_type& x, const point_type& y) {
+    return {x[0] - y[0], x[1] - y[1], x[2] - y[2]};
+}
+
+struct ShellPair {
+    std::size_t a;
+    std::size_t b;
+    point_type center;
+    double extent;
+    double q;
+    double d_max = 0.0;
+
+    // Multipoles of each function pair, (i * n_b + j) * n_comp + component
+    vector_type moments;
+
+    // Multipoles of the pair's share of the density
+    vector_type weighted;
+};
+
+struct Node {
+    point_type center;
+    double half_width;
+    double radius = 0.0;
+    std::size_t begin;
+    std::size_t end;
+    std::vector<std::size_t> children;
+    vector_type M;
+    vector_type L;
+
+    bool is_leaf() const { return children.empty(); }
+};
+
+class CFMM {
+public:
+    CFMM(basis_type basis, unsigned order, double theta,
+         std::size_t leaf_size, double thresh, std::size_t n_threads) :
+      m_basis_(std::move(basis)),
+      m_s2bf_(m_basis_.shell2bf()),
+      m_expansion_(order),
+      m_theta_(theta),
+      m_leaf_size_(leaf_size),
+      m_thresh_(thresh) {
+        set_n_threads_(n_threads);
+        make_pairs_();
+        compute_moments_();
+        build_tree_();
+        traverse_();
+    }
+
+    const basis_type& basis() const noexcept { return m_basis_; }
+
+    std::vector<double> coulomb(const std::vector<double>& P,
+                                std::size_t n_threads) {
+        set_n_threads_(n_threads);
+        upward_pass_(P);
+        interact_far_();
+        downward_pass_();
+
+        const auto n = m_basis_.nbf();
+        std::vector<double> J(n * n, 0.0);
+        evaluate_(P, J);
+        return J;
+    }
+
+private:
+    void set_n_threads_(std::size_t n_threads) {
+        m_n_threads_ = n_threads ? n_threads : utilities::default_n_threads();
+    }
+
+    libint2::Engine coulomb_engine_() const {
+        return libint2::Engine(libint2::Operator::coulomb,
+                               m_basis_.max_nprim(), m_basis_.max_l(), 0);
+    }
+
+    // Significant pairs with their centers, extents, and Schwarz factors
+    void make_pairs_() {
+        const auto log_thresh = std::log(m_thresh_);
+        const auto n_shells   = m_basis_.size();
+        auto engine           = coulomb_engine_();
+        const auto& buf       = engine.results();
+
+        for(std::size_t a = 0; a < n_shells; ++a) {
+            const auto& A = m_basis_[a];
+            for(std::size_t b = 0; b <= a; ++b) {
+                const auto& B = m_basis_[b];
+                const auto ab2 = std::pow(distance(A.O, B.O), 2);
+
+                // Centered on the most diffuse primitive product
+                const auto alpha =
+                  *std::min_element(A.alpha.begin(), A.alpha.end());
+                const auto beta =
+                  *std::min_element(B.alpha.begin(), B.alpha.end());
+                if(-alpha * beta / (alpha + beta) * ab2 < log_thresh) continue;
+
+                ShellPair pair{a, b, {}, 0.0, 0.0};
+                for(unsigned x = 0; x < 3; ++x)
+                    pair.center[x] =
+                      (alpha * A.O[x] + beta * B.O[x]) / (alpha + beta);
+                for(auto ai : A.alpha)
+                    for(auto bj : B.alpha) {
+                        const auto p = ai + bj;
+                        point_type P_ij;
+                        for(unsigned x = 0; x < 3; ++x)
+                            P_ij[x] = (ai * A.O[x] + bj * B.O[x]) / p;
+                        const auto r = distance(P_ij, pair.center) +
+                                       std::sqrt(-log_thresh / p);
+                        pair.extent = std::max(pair.extent, r);
+                    }
+
+                engine.compute(A, B, A, B);
+                if(buf[0] == nullptr) continue;
+                const auto nab = A.size() * B.size();
+                double q       = 0.0;
+                for(std::size_t ij = 0; ij < nab; ++ij)
+                    q = std::max(q, std::fabs(buf[0][ij * nab + ij]));
+                pair.q = std::sqrt(q);
+                m_pairs_.push_back(std::move(pair));
+            }
+        }
+    }
+
+    void compute_moments_() {
+        const auto op     = multipole_operator(m_expansion_.max_order());
+        const auto n_comp = m_expansion_.size();
+        auto chunk        = [&](std::size_t begin, std::size_t end) {
+            libint2::Engine engine(op, m_basis_.max_nprim(), m_basis_.max_l(),
+                                   0);
+            const auto& buf = engine.results();
+            for(std::size_t p = begin; p < end; ++p) {
+                auto& pair     = m_pairs_[p];
+                const auto& A  = m_basis_[pair.a];
+                const auto& B  = m_basis_[pair.b];
+                const auto nab = A.size() * B.size();
+                if(m_expansion_.max_order() > 0) engine.set_params(pair.center);
+                engine.compute(A, B);
+                pair.moments.assign(nab * n_comp, 0.0);
+                for(std::size_t c = 0; c < n_comp; ++c) {
+                    if(buf[c] == nullptr) continue;
+                    for(std::size_t ij = 0; ij < nab; ++ij)
+                        pair.moments[ij * n_comp + c] = buf[c][ij];
+                }
+            }
+        };
+        utilities::parallel_for(m_pairs_.size(), chunk, m_n_threads_);
+    }
+
+    void build_tree_() {
+        m_order_.resize(m_pairs_.size());
+        for(std::size_t p = 0; p < m_order_.size(); ++p) m_order_[p] = p;
+        if(m_pairs_.empty()) return;
+
+        point_type lo = m_pairs_[0].center;
+        point_type hi = lo;
+        for(const auto& pair : m_pairs_)
+            for(unsigned x = 0; x < 3; ++x) {
+                lo[x] = std::min(lo[x], pair.center[x]);
+                hi[x] = std::max(hi[x], pair.center[x]);
+            }
+        point_type center;
+        double half_width = 0.0;
+        for(unsigned x = 0; x < 3; ++x) {
+            center[x]  = 0.5 * (lo[x] + hi[x]);
+            half_width = std::max(half_width, 0.5 * (hi[x] - lo[x]));
+        }
+        build_node_(center, half_width, 0, m_order_.size(), 0);
+    }
+
+    std::size_t build_node_(const point_type& center, double half_width,
+                            std::size_t begin, std::size_t end,
+                            unsigned depth) {
+        const auto idx = m_nodes_.size();
+        m_nodes_.push_back(Node{center, half_width, 0.0, begin, end});
+        for(auto p = begin; p < end; ++p) {
+            const auto& pair = m_pairs_[m_order_[p]];
+            const auto r = distance(pair.center, center) + pair.extent;
+            m_nodes_[idx].radius = std::max(m_nodes_[idx].radius, r);
+        }
+
+        constexpr unsigned max_depth = 20;
+        if(end - begin <= m_leaf_size_ || depth == max_depth) return idx;
+
+        auto octant = [&](std::size_t p) {
+            const auto& x = m_pairs_[p].center;
+            return unsigned(x[0] > center[0]) |
+                   (unsigned(x[1] > center[1]) << 1) |
+                   (unsigned(x[2] > center[2]) << 2);
+        };
+        std::stable_sort(
+          m_order_.begin() + begin, m_order_.begin() + end,
+          [&](std::size_t p, std::size_t q) { return octant(p) < octant(q); });
+
+        const auto child_width = 0.5 * half_width;
+        for(auto first = begin; first < end;) {
+            const auto o = octant(m_order_[first]);
+            auto last    = first;
+            while(last < end && octant(m_order_[last]) == o) ++last;
+            point_type child_center;
+            for(unsigned x = 0; x < 3; ++x) {
+                const auto sign = (o >> x) & 1u ? 1.0 : -1.0;
+                child_center[x] = center[x] + sign * child_width;
+            }
+            const auto child =
+              build_node_(child_center, child_width, first, last, depth + 1);
+            m_nodes_[idx].children.push_back(child);
+            first = last;
+        }
+        return idx;
+    }
+
+    // Dual traversal sorting every (target, source) box pair into a list
+    void traverse_() {
+        m_far_.assign(m_nodes_.size(), {});
+        m_near_.assign(m_nodes_.size(), {});
+        if(m_nodes_.empty()) return;
+
+        std::vector<std::pair<std::size_t, std::size_t>> stack{{0, 0}};
+        while(!stack.empty()) {
+            const auto [t, s] = stack.back();
+            stack.pop_back();
+            const auto& T = m_nodes_[t];
+            const auto& S = m_nodes_[s];
+            const auto r  = distance(T.center, S.center);
+            if(T.radius + S.radius < m_theta_ * r) {
+                m_far_[t].push_back(s);
+            } else if(T.is_leaf() && S.is_leaf()) {
+                m_near_[t].push_back(s);
+            } else if(S.is_leaf() || (!T.is_leaf() && T.radius >= S.radius)) {
+                for(auto c : T.children) stack.emplace_back(c, s);
+            } else {
+                for(auto c : S.children) stack.emplace_back(t, c);
+            }
+        }
+    }
+
+    void upward_pass_(const std::vector<double>& P) {
+        const auto n      = m_basis_.nbf();
+        const auto n_comp = m_expansion_.size();
+        for(auto& pair : m_pairs_) {
+            const auto na  = m_basis_[pair.a].size();
+            const auto nb  = m_basis_[pair.b].size();
+            const auto deg = pair.a == pair.b ? 1.0 : 2.0;
+            pair.d_max     = 0.0;
+            pair.weighted.assign(n_comp, 0.0);
+            for(std::size_t i = 0; i < na; ++i)
+                for(std::size_t j = 0; j < nb; ++j) {
+                    const auto mu = m_s2bf_[pair.a] + i;
+                    const auto nu = m_s2bf_[pair.b] + j;
+                    const auto p  = P[mu * n + nu];
+                    pair.d_max    = std::max(pair.d_max, std::fabs(p));
+                    const auto* m = pair.moments.data() + (i * nb + j) * n_comp;
+                    for(std::size_t c = 0; c < n_comp; ++c)
+                        pair.weighted[c] += deg * p * m[c];
+                }
+        }
+
+        // Children are created after their parents
+        for(auto idx = m_nodes_.size(); idx-- > 0;) {
+            auto& node = m_nodes_[idx];
+            node.M.assign(n_comp, 0.0);
+            node.L.assign(n_comp, 0.0);
+            auto add = [&](const vector_type& M, const point_type& center) {
+                const auto d = difference(center, node.center);
+                const auto M_node = m_expansion_.translate_multipoles(M, d);
+                for(std::size_t c = 0; c < n_comp; ++c) node.M[c] += M_node[c];
+            };
+            if(node.is_leaf()) {
+                for(auto p = node.begin; p < node.end; ++p) {
+                    const auto& pair = m_pairs_[m_order_[p]];
+                    add(pair.weighted, pair.center);
+                }
+            } else {
+                for(auto c : node.children)
+                    add(m_nodes_[c].M, m_nodes_[c].center);
+            }
+        }
+    }
+
+    void interact_far_() {
+        auto chunk = [&](std::size_t begin, std::size_t end) {
+            for(auto t = begin; t < end; ++t) {
+                auto& T = m_nodes_[t];
+                for(auto s : m_far_[t]) {
+                    const auto& S = m_nodes_[s];
+                    const auto R  = difference(T.center, S.center);
+                    m_expansion_.multipoles_to_local(S.M, R, T.L);
+                }
+            }
+        };
+        utilities::parallel_for(m_nodes_.size(), chunk, m_n_threads_);
+    }
+
+    void downward_pass_() {
+        for(const auto& node : m_nodes_) {
+            for(auto c : node.children) {
+                auto& child  = m_nodes_[c];
+                const auto d = difference(child.center, node.center);
+                const auto L = m_expansion_.translate_local(node.L, d);
+                for(std::size_t i = 0; i < L.size(); ++i) child.L[i] += L[i];
+            }
+        }
+    }
+
+    // Far field from each leaf's local expansion, near field exactly
+    void evaluate_(const std::vector<double>& P, std::vector<double>& J) {
+        const auto n      = m_basis_.nbf();
+        const auto n_comp = m_expansion_.size();
+        std::vector<std::size_t> leaves;
+        for(std::size_t t = 0; t < m_nodes_.size(); ++t)
+            if(m_nodes_[t].is_leaf()) leaves.push_back(t);
+
+        std::atomic<std::size_t> next_leaf{0};
+        auto worker = [&](std::size_t, std::size_t) {
+            auto engine     = coulomb_engine_();
+            const auto& buf = engine.results();
+            std::vector<double> J_ab;
+
+            for(auto l = next_leaf++; l < leaves.size(); l = next_leaf++) {
+                const auto& T = m_nodes_[leaves[l]];
+                for(auto p = T.begin; p < T.end; ++p) {
+                    const auto& ab = m_pairs_[m_order_[p]];
+                    const auto& A  = m_basis_[ab.a];
+                    const auto& B  = m_basis_[ab.b];
+                    const auto na  = A.size();
+                    const auto nb  = B.size();
+                    J_ab.assign(na * nb, 0.0);
+
+                    const auto d = difference(ab.center, T.center);
+                    const auto L = m_expansion_.translate_local(T.L, d);
+                    for(std::size_t ij = 0; ij < na * nb; ++ij)
+                        J_ab[ij] = m_expansion_.contract(
+                          L, ab.moments.data() + ij * n_comp);
+
+                    for(auto s : m_near_[leaves[l]]) {
+                        const auto& S = m_nodes_[s];
+                        for(auto r = S.begin; r < S.end; ++r) {
+                            const auto& cd = m_pairs_[m_order_[r]];
+                            if(ab.q * cd.q * cd.d_max < m_thresh_) continue;
+                            const auto& C = m_basis_[cd.a];
+                            const auto& D = m_basis_[cd.b];
+                            engine.compute(A, B, C, D);
+                            const auto* abcd = buf[0];
+                            if(abcd == nullptr) continue;
+
+                            const auto deg = cd.a == cd.b ? 1.0 : 2.0;
+                            const auto nc  = C.size();
+                            const auto nd  = D.size();
+                            std::size_t f  = 0;
+                            for(std::size_t ij = 0; ij < na * nb; ++ij) {
+                                double sum = 0.0;
+                                for(std::size_t k = 0; k < nc; ++k) {
+                                    const auto* row =
+                                      P.data() + (m_s2bf_[cd.a] + k) * n +
+                                      m_s2bf_[cd.b];
+                                    for(std::size_t m = 0; m < nd; ++m, ++f)
+                                        sum += abcd[f] * row[m];
+                                }
+                                J_ab[ij] += deg * sum;
+                            }
+                        }
+                    }
+
+                    // Each pair is in exactly one leaf, so writes don't race
+                    for(std::size_t i = 0; i < na; ++i)
+                        for(std::size_t j = 0; j < nb; ++j) {
+                            const auto mu  = m_s2bf_[ab.a] + i;
+                            const auto nu  = m_s2bf_[ab.b] + j;
+                            J[mu * n + nu] = J_ab[i * nb + j];
+                            J[nu * n + mu] = J_ab[i * nb + j];
+                        }
+                }
+            }
+        };
+        utilities::parallel_for(m_n_threads_, worker, m_n_threads_);
+    }
+
+    basis_type m_basis_;
+    std::vector<std::size_t> m_s2bf_;
+    CartesianExpansion m_expansion_;
+    double m_theta_;
+    std::size_t m_leaf_size_;
+    double m_thresh_;
+    std::size_t m_n_threads_ = 1;
+
+    std::vector<ShellPair> m_pairs_;
+    std::vector<std::size_t> m_order_;
+    std::vector<Node> m_nodes_;
+    std::vector<std::vector<std::size_t>> m_far_;
+    std::vector<std::vector<std::size_t>> m_near_;
+};
+
+struct Kernel {
+    CFMM& m_cfmm;
+    std::size_t m_n;
+    std::size_t m_n_threads;
+
+    template<typename FloatType>
+    simde::type::tensor operator()(const std::span<FloatType>& P_in) {
+        using clean_t = std::decay_t<FloatType>;
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error("CFMM J: UQ types not supported");
+        } else {
+            std::vector<double> P(P_in.begin(), P_in.end());
+            const auto J = m_cfmm.coulomb(P, m_n_threads);
+            std::vector<clean_t> J_out(J.begin(), J.end());
+            using tensorwrapper::utilities::make_tensor;
+            return make_tensor({m_n, m_n}, J_out);
+        }
+    }
+};
+
+} // namespace
+
+using pt = simde::aos_j_e_aos;
+
+MODULE_CTOR(CFMMJ) {
+    description(desc);
+    satisfies_property_type<pt>();
+
+    add_input<std::size_t>("multipole order")
+      .set_default(std::size_t{3})
+      .set_description("Highest order of the multipole expansions (at most 3)");
+    add_input<double>("opening angle")
+      .set_default(0.25)
+      .set_description("Boxes interact through multipoles when the sum of "
+                       "their radii is below this times their separation");
+    add_input<std::size_t>("leaf size")
+      .set_default(std::size_t{16})
+      .set_description("Maximum number of shell pairs in an octree leaf");
+    add_input<double>("screening threshold")
+      .set_default(1.0E-12)
+      .set_description("Threshold for pair extents and near-field screening");
+    add_input<std::size_t>("max threads")
+      .set_default(std::size_t{0})
+      .set_description("Maximum number of threads (0 means all)");
+}
+
+MODULE_RUN(CFMMJ) {
+    const auto& [braket] = pt::unwrap_inputs(inputs);
+    const auto order     = inputs.at("multipole order").value<std::size_t>();
+    const auto theta     = inputs.at("opening angle").value<double>();
+    const auto leaf_size = inputs.at("leaf size").value<std::size_t>();
+    const auto thresh    = inputs.at("screening threshold").value<double>();
+    const auto n_threads = inputs.at("max threads").value<std::size_t>();
+
+    const auto& bra_aos = braket.bra();
+    const auto& j_op    = braket.op();
+    const auto& ket_aos = braket.ket();
+
+    if(bra_aos != ket_aos)
+        throw std::runtime_error("Expected the same basis set!");
+    if(order > max_multipole_order)
+        throw std::runtime_error("CFMM J: multipole order must be at most 3");
+    if(theta <= 0.0 || theta >= 1.0)
+        throw std::runtime_error("CFMM J: opening angle must be in (0, 1)");
+
+    // The setup (pairs, moments, tree, and interaction lists) is reused
+    // while the basis set and the inputs stay the same. coulomb() writes the
+    // density-dependent parts of it, so it is used under the cache's lock.
+    const auto leaf = std::max<std::size_t>(leaf_size, 1);
+    SetupKey key{basis_fingerprint(bra_aos), nullptr, typeid(CFMM),
+                 {double(order), theta, double(leaf), thresh}};
+    static SetupCache cache;
+    auto lock  = cache.lock();
+    auto setup = cache.get<CFMM>(key, [&]() {
+        utilities::initialize_libint();
+        auto basis = utilities::make_libint_basis(bra_aos.ao_basis_set());
+        return std::make_shared<CFMM>(std::move(basis), order, theta, leaf,
+                                      thresh, n_threads);
+    });
+    auto& cfmm     = *setup;
+    const auto nbf = cfmm.basis().nbf();
+
+    const auto& P = j_op.get_rhs_particle().value();
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& p_buffer = make_contiguous(P.buffer());
+    if(p_buffer.shape().extent(0) != nbf)
+        throw std::runtime_error("CFMM J: density is not in the AO basis");
+
+    Kernel kernel{cfmm, nbf, n_threads};
+    auto J = visit_contiguous_buffer(kernel, p_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, J);
+}
+
+} // namespace scf::jk
+#endif
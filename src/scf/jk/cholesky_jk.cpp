@@ -0,0 +1,388 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cholesky_vector_store.hpp"
+#include "jk.hpp"
+#include "setup_cache.hpp"
+#include "three_index_jk.hpp"
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#ifdef BUILD_TAMM_SCF
+#include "../utilities/libint_basis.hpp"
+#endif
+
+namespace scf::jk {
+namespace {
+
+const auto desc = R"(
+Cholesky-Decomposed J and K
+---------------------------
+
+Approximates the ERIs, viewed as the symmetric positive semi-definite matrix
+M_(mn),(ls) = (mn|ls), by a pivoted (incomplete) Cholesky decomposition
+M ~ sum_Q L_Q L_Q^T, stopping once the largest remaining diagonal element
+drops below "Cholesky threshold". The threshold bounds the error in every
+integral, so the accuracy is controlled without an auxiliary basis.
+
+Since (mn| = (nm|, the decomposition runs over the n(n+1)/2 unique pairs
+(mn), m >= n. Only the diagonal (mn|mn) and the columns (..|ls) of the
+chosen pivots are evaluated, and each new vector is orthogonalized against
+the previous ones with one matrix-vector product. With libint2 available the
+columns are computed shell pair by shell pair on demand (all columns of a
+pivot's shell pair at once), so the n^4 ERI tensor is never formed.
+Otherwise the columns are read from the full ERI tensor of the "ERI4"
+submodule.
+
+The decomposition is done once per AO basis set and threshold and its vectors
+are kept in a contiguous store, optionally moved to a memory-mapped file in
+"scratch directory" (the system's temporary directory if empty). Every build
+after that is J = sum_Q L_Q (L_Q . P) and K = sum_Q (L_Q X) S (L_Q X)^T with
+P = X S X^T (a pivoted Cholesky factorization of P, as in RI-K), i.e., dense
+matrix products only. Only the most recent decomposition is retained; it is
+reused only if the basis set, the integral submodule, the threshold, the
+float type, "memory map", and (if memory mapped) "scratch directory" all
+match.
+)";
+
+constexpr double p_factor_thresh = 1.0E-12;
+
+template<typename FloatType>
+using store_type = CholeskyVectorStore<FloatType>;
+
+// The unique pairs (i, j), i >= j, in the order of their compound index
+std::vector<std::array<std::size_t, 2>> unique_pairs(std::size_t n) {
+    std::vector<std::array<std::size_t, 2>> pairs;
+    pairs.reserve(n * (n + 1) / 2);
+    for(std::size_t i = 0; i < n; ++i)
+        for(std::size_t j = 0; j <= i; ++j) pairs.push_back({i, j});
+    return pairs;
+}
+
+std::size_t pair_index(std::size_t i, std::size_t j) {
+    if(i < j) std::swap(i, j);
+    return i * (i + 1) / 2 + j;
+}
+
+/* Pivoted Cholesky of the ERI matrix over the unique pairs. Columns provides
+ * diagonal(), the n(n+1)/2 integrals (ij|ij), and column(p, out), which sets
+ * out[ij] = (ij|kl) for the p-th pair kl. The vectors are unpacked to full
+ * n^2 vectors in the returned store.
+ */
+template<typename FloatType, typename Columns>
+auto decompose(Columns& eris, std::size_t n, double tau) {
+    constexpr auto edynam = Eigen::Dynamic;
+    using matrix_type     = Eigen::Matrix<FloatType, edynam, edynam>;
+    using vector_type     = Eigen::Matrix<FloatType, edynam, 1>;
+    const auto n_pairs    = static_cast<Eigen::Index>(n * (n + 1) / 2);
+
+    vector_type D = eris.diagonal();
+    matrix_type L(n_pairs, std::min<Eigen::Index>(n_pairs, 64));
+    vector_type column(n_pairs);
+    Eigen::Index n_vec = 0;
+    for(; n_vec < n_pairs; ++n_vec) {
+        Eigen::Index p;
+        const FloatType d_p = D.maxCoeff(&p);
+        if(d_p <= tau) break;
+
+        // L_new = (M[:, p] - sum_Q L_Q L_Q[p]) / sqrt(D[p])
+        eris.column(p, column.data());
+        if(n_vec > 0)
+            column.noalias() -= L.leftCols(n_vec) * L.row(p).transpose();
+        if(n_vec == L.cols())
+            L.conservativeResize(Eigen::NoChange,
+                                 std::min(n_pairs, 2 * L.cols()));
+        L.col(n_vec) = column / std::sqrt(d_p);
+        D -= L.col(n_vec).cwiseAbs2();
+        D(p) = FloatType(0.0);
+    }
+
+    auto store = std::make_shared<store_type<FloatType>>(n * n);
+    for(Eigen::Index Q = 0; Q < n_vec; ++Q) {
+        auto* L_Q = store->emplace_back();
+        for(std::size_t i = 0; i < n; ++i)
+            for(std::size_t j = 0; j <= i; ++j)
+                L_Q[i * n + j] = L_Q[j * n + i] = L(pair_index(i, j), Q);
+    }
+    return store;
+}
+
+// Columns of the ERI matrix read from the row-major n^4 ERI tensor
+template<typename FloatType>
+struct DenseColumns {
+    using vector_type = Eigen::Matrix<FloatType, Eigen::Dynamic, 1>;
+
+    const FloatType* m_eri;
+    std::size_t m_n;
+    std::vector<std::array<std::size_t, 2>> m_pairs = unique_pairs(m_n);
+
+    FloatType eri_(std::size_t ij, std::size_t kl) const {
+        const auto [i, j] = m_pairs[ij];
+        const auto [k, l] = m_pairs[kl];
+        return m_eri[((i * m_n + j) * m_n + k) * m_n + l];
+    }
+
+    vector_type diagonal() const {
+        vector_type D(m_pairs.size());
+        for(std::size_t ij = 0; ij < m_pairs.size(); ++ij) D(ij) = eri_(ij, ij);
+        return D;
+    }
+
+    void column(std::size_t kl, FloatType* out) const {
+        for(std::size_t ij = 0; ij < m_pairs.size(); ++ij)
+            out[ij] = eri_(ij, kl);
+    }
+};
+
+#ifdef BUILD_TAMM_SCF
+/* Columns of the ERI matrix from libint2. A column (..|kl) is computed with
+ * the rest of its shell pair cd, i.e., as (ab|cd) over all shell pairs ab,
+ * and the columns of the most recent shell pair are kept for later pivots.
+ */
+template<typename FloatType>
+class LibintColumns {
+public:
+    using vector_type = Eigen::Matrix<FloatType, Eigen::Dynamic, 1>;
+
+    explicit LibintColumns(libint2::BasisSet basis) :
+      m_basis_(std::move(basis)),
+      m_s2bf_(m_basis_.shell2bf()),
+      m_bf2s_(m_basis_.bf2shell()),
+      m_pairs_(unique_pairs(m_basis_.nbf())),
+      m_engine_(libint2::Operator::coulomb, m_basis_.max_nprim(),
+                m_basis_.max_l(), 0) {}
+
+    vector_type diagonal() {
+        vector_type D(m_pairs_.size());
+        const auto& buf = m_engine_.results();
+        for(std::size_t a = 0; a < m_basis_.size(); ++a)
+            for(std::size_t b = 0; b <= a; ++b) {
+                const auto& sa = m_basis_[a];
+                const auto& sb = m_basis_[b];
+                m_engine_.compute(sa, sb, sa, sb);
+                const auto nab = sa.size() * sb.size();
+                for(std::size_t i = 0; i < sa.size(); ++i)
+                    for(std::size_t j = 0; j < sb.size(); ++j) {
+                        const auto ii = m_s2bf_[a] + i;
+                        const auto jj = m_s2bf_[b] + j;
+                        if(jj > ii) continue;
+                        const auto f = i * sb.size() + j;
+                        D(pair_index(ii, jj)) =
+                          buf[0] == nullptr ? 0.0 : buf[0][f * nab + f];
+                    }
+            }
+        return D;
+    }
+
+    void column(std::size_t kl, FloatType* out) {
+        const auto [k, l] = m_pairs_[kl];
+        const std::array<std::size_t, 2> cd{m_bf2s_[k], m_bf2s_[l]};
+        if(cd != m_cd_) compute_shell_pair_(cd);
+        const auto nd  = m_basis_[cd[1]].size();
+        const auto col = (k - m_s2bf_[cd[0]]) * nd + (l - m_s2bf_[cd[1]]);
+        for(std::size_t ij = 0; ij < m_pairs_.size(); ++ij)
+            out[ij] = FloatType(m_block_(ij, col));
+    }
+
+private:
+    // (ij|kl) for all pairs ij and all k in shell c, l in shell d
+    void compute_shell_pair_(std::array<std::size_t, 2> cd) {
+        const auto [c, d] = cd;
+        const auto& sc   = m_basis_[c];
+        const auto& sd   = m_basis_[d];
+        const auto ncd   = sc.size() * sd.size();
+        m_block_.setZero(m_pairs_.size(), ncd);
+        const auto& buf = m_engine_.results();
+        for(std::size_t a = 0; a < m_basis_.size(); ++a)
+            for(std::size_t b = 0; b <= a; ++b) {
+                const auto& sa = m_basis_[a];
+                const auto& sb = m_basis_[b];
+                m_engine_.compute(sa, sb, sc, sd);
+                if(buf[0] == nullptr) continue;
+                for(std::size_t i = 0; i < sa.size(); ++i)
+                    for(std::size_t j = 0; j < sb.size(); ++j) {
+                        const auto ii = m_s2bf_[a] + i;
+                        const auto jj = m_s2bf_[b] + j;
+                        if(jj > ii) continue;
+                        const auto* row = buf[0] + (i * sb.size() + j) * ncd;
+                        for(std::size_t x = 0; x < ncd; ++x)
+                            m_block_(pair_index(ii, jj), x) = row[x];
+                    }
+            }
+        m_cd_ = cd;
+    }
+
+    libint2::BasisSet m_basis_;
+    std::vector<std::size_t> m_s2bf_;
+    std::vector<long> m_bf2s_;
+    std::vector<std::array<std::size_t, 2>> m_pairs_;
+    libint2::Engine m_engine_;
+    std::array<std::size_t, 2> m_cd_{SIZE_MAX, SIZE_MAX};
+    Eigen::MatrixXd m_block_;
+};
+#else
+// Decomposes the row-major n^4 ERIs of type FloatType into m_store
+template<typename FloatType>
+struct DenseDecomposer {
+    std::size_t m_n;
+    double m_tau;
+    std::shared_ptr<store_type<FloatType>> m_store;
+
+    template<typename OtherType>
+    void operator()(const std::span<OtherType>& eri) {
+        if constexpr(!std::is_same_v<std::decay_t<OtherType>, FloatType>) {
+            throw std::runtime_error(
+              "Cholesky J and K: Mixed float types not supported");
+        } else {
+            DenseColumns<FloatType> columns{eri.data(), m_n};
+            m_store = decompose<FloatType>(columns, m_n, m_tau);
+        }
+    }
+};
+#endif
+
+struct Kernel {
+    using return_type = std::tuple<simde::type::tensor, simde::type::tensor>;
+
+    std::size_t m_n;
+    const simde::type::aos& m_aos;
+    pluginplay::type::submodule_map& m_submods;
+    double m_tau;
+    bool m_mmap;
+    std::filesystem::path m_scratch;
+
+    template<typename FloatType>
+    return_type operator()(const std::span<FloatType>& P) {
+        using clean_t = std::decay_t<FloatType>;
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error(
+              "Cholesky J and K: UQ types not supported");
+        } else {
+            auto store = get_store_<clean_t>();
+            ThreeIndexJK<clean_t> jk(store->data(), store->size(), m_n);
+            using tensorwrapper::utilities::make_tensor;
+            return return_type{
+              make_tensor({m_n, m_n}, jk.coulomb(P.data())),
+              make_tensor({m_n, m_n}, jk.exchange(P.data(), p_factor_thresh))};
+        }
+    }
+
+    template<typename FloatType>
+    std::shared_ptr<const store_type<FloatType>> get_store_() {
+        // The store isn't a tensor (it may be memory mapped), so the most
+        // recent one is kept in a SetupCache rather than memoized
+        static SetupCache cache;
+        SetupKey key{basis_fingerprint(m_aos), eri_module_(),
+                     typeid(FloatType), {m_tau},
+                     m_mmap ? m_scratch.string() : std::string{}};
+        return cache.get<store_type<FloatType>>(key, [&]() {
+            auto store = decompose_<FloatType>();
+            if(m_mmap) store->memory_map(m_scratch);
+            return store;
+        });
+    }
+
+#ifdef BUILD_TAMM_SCF
+    const pluginplay::Module* eri_module_() const { return nullptr; }
+
+    template<typename FloatType>
+    std::shared_ptr<store_type<FloatType>> decompose_() {
+        utilities::initialize_libint();
+        auto basis = utilities::make_libint_basis(m_aos.ao_basis_set());
+        if(basis.nbf() != m_n)
+            throw std::runtime_error("Density is not in the AO basis");
+        LibintColumns<FloatType> columns(std::move(basis));
+        return decompose<FloatType>(columns, m_n, m_tau);
+    }
+#else
+    const pluginplay::Module* eri_module_() const {
+        return &m_submods.at("ERI4").value();
+    }
+
+    template<typename FloatType>
+    std::shared_ptr<store_type<FloatType>> decompose_() {
+        simde::type::aos_squared aos2(m_aos, m_aos);
+        simde::type::v_ee_type v_ee;
+        chemist::braket::BraKet mnls(aos2, v_ee, aos2);
+        const auto eri = m_submods.at("ERI4").run_as<simde::ERI4>(mnls);
+
+        using tensorwrapper::buffer::make_contiguous;
+        using tensorwrapper::buffer::visit_contiguous_buffer;
+        const auto& eri_buffer = make_contiguous(eri.buffer());
+        if(eri_buffer.shape().extent(0) != m_n)
+            throw std::runtime_error(
+              "Density and ERIs have different AO bases");
+        DenseDecomposer<FloatType> decomposer{m_n, m_tau, nullptr};
+        visit_contiguous_buffer(decomposer, eri_buffer);
+        return decomposer.m_store;
+    }
+#endif
+};
+
+} // namespace
+
+using pt = JKDriver;
+
+MODULE_CTOR(CholeskyJK) {
+    description(desc);
+    satisfies_property_type<pt>();
+#ifndef BUILD_TAMM_SCF
+    add_submodule<simde::ERI4>("ERI4");
+#endif
+
+    add_input<double>("Cholesky threshold")
+      .set_default(1.0E-8)
+      .set_description("Largest allowed residual diagonal ERI");
+    add_input<bool>("memory map")
+      .set_default(false)
+      .set_description("Keep the Cholesky vectors in a memory-mapped file?");
+    add_input<std::string>("scratch directory")
+      .set_default(std::string{})
+      .set_description("Where to put the memory-mapped file");
+}
+
+MODULE_RUN(CholeskyJK) {
+    const auto& [aos, P] = pt::unwrap_inputs(inputs);
+    const auto tau       = inputs.at("Cholesky threshold").value<double>();
+    const auto use_mmap  = inputs.at("memory map").value<bool>();
+
+    auto scratch = inputs.at("scratch directory").value<std::string>();
+
+    std::filesystem::path scratch_dir(scratch);
+    if(scratch.empty()) scratch_dir = std::filesystem::temp_directory_path();
+
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& p_buffer = make_contiguous(P.buffer());
+    const auto n         = p_buffer.shape().extent(0);
+
+    Kernel kernel{n, aos, submods, tau, use_mmap, scratch_dir};
+    auto [J, K] = visit_contiguous_buffer(kernel, p_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, J, K);
+}
+
+} // namespace scf::jk
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "scratch_file.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+namespace scf::jk {
+
+/** @brief Contiguous storage for Cholesky (or any three-index) vectors.
+ *
+ *  Vectors all have the same length and are stored back to back, so the
+ *  whole set can be used as one row-major n_vectors by length matrix. While
+ *  the vectors are being generated they live in memory; memory_map() then
+ *  moves them to a file-backed, read-only mapping so that the operating
+ *  system may page them out between uses. The backing file is unlinked as
+ *  soon as it is mapped, so it never outlives the store.
+ *
+ *  @tparam FloatType The type of the vector elements.
+ */
+template<typename FloatType>
+class CholeskyVectorStore {
+public:
+    using value_type = FloatType;
+    using size_type  = std::size_t;
+
+    explicit CholeskyVectorStore(size_type length) : m_length_(length) {}
+
+    CholeskyVectorStore(const CholeskyVectorStore&)            = delete;
+    CholeskyVectorStore& operator=(const CholeskyVectorStore&) = delete;
+
+    ~CholeskyVectorStore() noexcept { unmap_(); }
+
+    /// Length of each vector
+    size_type length() const noexcept { return m_length_; }
+
+    /// Number of vectors
+    size_type size() const noexcept { return m_size_; }
+
+    /// Is the store backed by a memory-mapped file?
+    bool is_mapped() const noexcept { return m_pmap_ != nullptr; }
+
+    /// Pointer to element 0 of vector 0
+    const value_type* data() const noexcept {
+        return is_mapped() ? m_pmap_ : m_data_.data();
+    }
+
+    /// Pointer to element 0 of vector @p i
+    const value_type* vector(size_type i) const noexcept {
+        return data() + i * m_length_;
+    }
+
+    /** @brief Appends a new, zero-initialized vector and returns it.
+     *
+     *  @throw std::runtime_error if the store has been memory mapped.
+     */
+    value_type* emplace_back() {
+        if(is_mapped())
+            throw std::runtime_error("Can't append to a mapped vector store");
+        m_data_.resize(m_data_.size() + m_length_, value_type(0.0));
+        ++m_size_;
+        return m_data_.data() + (m_size_ - 1) * m_length_;
+    }
+
+    /** @brief Moves the vectors into a memory-mapped file in @p dir.
+     *
+     *  @throw std::runtime_error if the file can't be created or mapped. The
+     *                            store is unchanged in that case.
+     */
+    void memory_map(const std::filesystem::path& dir) {
+        if(is_mapped() || m_data_.empty()) return;
+        const int fd       = scratch::open_file(dir, "scf_cholesky");
+        const auto n_bytes = m_data_.size() * sizeof(value_type);
+        const void* pmap   = nullptr;
+        try {
+            scratch::write_all(fd, m_data_.data(), n_bytes);
+            pmap = scratch::map_read_only(fd, n_bytes);
+        } catch(...) {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+
+        m_pmap_      = static_cast<const value_type*>(pmap);
+        m_map_bytes_ = n_bytes;
+        std::vector<value_type>().swap(m_data_);
+    }
+
+private:
+    void unmap_() noexcept {
+        if(!is_mapped()) return;
+        scratch::unmap(m_pmap_, m_map_bytes_);
+        m_pmap_ = nullptr;
+    }
+
+    size_type m_length_;
+    size_type m_size_ = 0;
+    std::vector<value_type> m_data_;
+    const value_type* m_pmap_ = nullptr;
+    size_type m_map_bytes_    = 0;
+};
+
+} // namespace scf::jk
@@ -0,0 +1,341 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../utilities/parallel_for.hpp"
+#include "jk.hpp"
+#include "jk_scatter.hpp"
+#include "packed_eri_store.hpp"
+#include "setup_cache.hpp"
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#ifdef BUILD_TAMM_SCF
+#include "../utilities/libint_basis.hpp"
+#endif
+
+namespace scf::jk {
+namespace {
+
+const auto desc = R"(
+Conventional J and K
+--------------------
+
+Conventional (stored-integral) SCF. The first build for a given AO basis set
+evaluates the ERIs and keeps only the symmetry-unique integrals (ij|kl),
+i >= j, k >= l, (ij) >= (kl), whose magnitude is at least "screening
+threshold", together with their indices. With libint2 available they are
+computed shell quartet by shell quartet, only for the symmetry-unique
+quartets whose Schwarz bound (from the "Schwarz factors" submodule) reaches
+the threshold, and packed as they come. Otherwise the full ERI tensor is
+taken from the "ERI4" submodule and packed.
+The integrals are held in memory if they fit in "memory budget" MiB and are
+otherwise written to a memory-mapped file in "scratch directory" (the
+system's temporary directory if empty).
+
+Every build, including those of later SCFs on the same geometry, then
+streams over the stored integrals front to back, in one contiguous range per
+thread, and scatters each into J and K with its permutational degeneracy.
+No integrals are evaluated again. Only the most recent store is retained;
+it is rebuilt whenever the basis set, the integral submodule, the threshold,
+the memory budget, the scratch directory, or the float type changes.
+
+In builds with libint2 this is the "Stored JK driver" of the SCF integral
+driver, used when its "conventional" input is set. Other builds can still
+run it directly, once its "ERI4" submodule is set.
+)";
+
+template<typename FloatType>
+using store_type = PackedERIStore<FloatType>;
+
+constexpr std::size_t bytes_per_mib = std::size_t(1) << 20;
+
+// Fills the store from the row-major n^4 ERIs of type FloatType
+template<typename FloatType>
+struct Packer {
+    store_type<FloatType>& m_store;
+    std::size_t m_n;
+    double m_thresh;
+
+    template<typename OtherType>
+    void operator()(const std::span<OtherType>& eri) {
+        if constexpr(!std::is_same_v<std::decay_t<OtherType>, FloatType>) {
+            throw std::runtime_error(
+              "Conventional J and K: Mixed float types not supported");
+        } else {
+            const auto n = m_n;
+            for(std::size_t i = 0; i < n; ++i)
+                for(std::size_t j = 0; j <= i; ++j)
+                    for(std::size_t k = 0; k <= i; ++k)
+                        for(std::size_t l = 0; l <= (k == i ? j : k); ++l) {
+                            const auto v = eri[((i * n + j) * n + k) * n + l];
+                            if(std::fabs(v) < m_thresh) continue;
+                            m_store.push_back(i, j, k, l, v);
+                        }
+            m_store.finalize();
+        }
+    }
+};
+
+#ifdef BUILD_TAMM_SCF
+// Appends the integrals of the shell quartet (ab|cd), starting at AOs i0, j0,
+// k0, l0, that are symmetry-unique and reach the threshold
+template<typename FloatType>
+struct QuartetPacker {
+    store_type<FloatType>& m_store;
+    double m_thresh;
+
+    void operator()(const double* abcd, std::array<std::size_t, 4> first,
+                    std::array<std::size_t, 4> size) {
+        const auto [i0, j0, k0, l0] = first;
+        const auto [ni, nj, nk, nl] = size;
+
+        // Permutations that map an integral onto the same quartet are skipped
+        const bool same_ab   = (i0 == j0);
+        const bool same_cd   = (k0 == l0);
+        const bool same_pair = (i0 == k0 && j0 == l0);
+
+        std::size_t f = 0;
+        for(auto i = i0; i < i0 + ni; ++i)
+            for(auto j = j0; j < j0 + nj; ++j)
+                for(auto k = k0; k < k0 + nk; ++k)
+                    for(auto l = l0; l < l0 + nl; ++l, ++f) {
+                        if(same_ab && j > i) continue;
+                        if(same_cd && l > k) continue;
+                        if(same_pair && std::pair(k, l) > std::pair(i, j))
+                            continue;
+                        if(std::fabs(abcd[f]) < m_thresh) continue;
+                        push_(i, j, k, l, FloatType(abcd[f]));
+                    }
+    }
+
+    // Stores (ij|kl) with i >= j, k >= l, and (ij) >= (kl)
+    void push_(std::size_t i, std::size_t j, std::size_t k, std::size_t l,
+               FloatType v) {
+        if(i < j) std::swap(i, j);
+        if(k < l) std::swap(k, l);
+        if(std::pair(i, j) < std::pair(k, l)) {
+            std::swap(i, k);
+            std::swap(j, l);
+        }
+        m_store.push_back(i, j, k, l, v);
+    }
+};
+
+// Fills the store from the symmetry-unique shell quartets whose Schwarz bound
+// reaches the threshold
+template<typename FloatType>
+void pack_quartets(store_type<FloatType>& store, const libint2::BasisSet& basis,
+                   const std::vector<double>& Q, double thresh) {
+    const auto n_shells = basis.size();
+    const auto s2bf     = basis.shell2bf();
+    libint2::Engine engine(libint2::Operator::coulomb, basis.max_nprim(),
+                           basis.max_l(), 0);
+    const auto& buf = engine.results();
+    QuartetPacker<FloatType> packer{store, thresh};
+
+    for(std::size_t a = 0; a < n_shells; ++a)
+        for(std::size_t b = 0; b <= a; ++b)
+            for(std::size_t c = 0; c <= a; ++c)
+                for(std::size_t d = 0; d <= (c == a ? b : c); ++d) {
+                    const auto q_ab = Q[a * n_shells + b];
+                    if(q_ab * Q[c * n_shells + d] < thresh) continue;
+
+                    engine.compute(basis[a], basis[b], basis[c], basis[d]);
+                    if(buf[0] == nullptr) continue;
+                    packer(buf[0], {s2bf[a], s2bf[b], s2bf[c], s2bf[d]},
+                           {basis[a].size(), basis[b].size(), basis[c].size(),
+                            basis[d].size()});
+                }
+    store.finalize();
+}
+#endif
+
+// J and K from one pass over the store
+template<typename FloatType>
+auto stream_jk(const store_type<FloatType>& store, const FloatType* P,
+               std::size_t n, std::size_t n_threads) {
+    std::vector<FloatType> J(n * n, FloatType(0.0));
+    std::vector<FloatType> K(n * n, FloatType(0.0));
+    std::mutex reduce_mutex;
+
+    auto chunk = [&](std::size_t begin, std::size_t end) {
+        std::vector<FloatType> J_t(n * n, FloatType(0.0));
+        std::vector<FloatType> K_t(n * n, FloatType(0.0));
+        const auto* records = store.data();
+        for(auto r = begin; r < end; ++r) {
+            const auto& [index, value] = records[r];
+            const std::size_t i = index[0], j = index[1];
+            const std::size_t k = index[2], l = index[3];
+
+            const auto deg = quartet_degeneracy(i == j, k == l,
+                                                i == k && j == l);
+            scatter_jk(i, j, k, l, value * FloatType(deg), P, n, J_t.data(),
+                       K_t.data());
+        }
+        std::lock_guard lock(reduce_mutex);
+        for(std::size_t x = 0; x < n * n; ++x) {
+            J[x] += J_t[x];
+            K[x] += K_t[x];
+        }
+    };
+    utilities::parallel_for(store.size(), chunk, n_threads);
+    symmetrize_jk(J, K, n);
+    return std::make_tuple(std::move(J), std::move(K));
+}
+
+struct Kernel {
+    using return_type = std::tuple<simde::type::tensor, simde::type::tensor>;
+
+    std::size_t m_n;
+    const simde::type::aos& m_aos;
+    pluginplay::type::submodule_map& m_submods;
+    double m_thresh;
+    std::size_t m_budget;
+    std::filesystem::path m_scratch;
+    std::size_t m_n_threads;
+
+    template<typename FloatType>
+    return_type operator()(const std::span<FloatType>& P) {
+        using clean_t = std::decay_t<FloatType>;
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error(
+              "Conventional J and K: UQ types not supported");
+        } else {
+            auto store  = get_store_<clean_t>();
+            auto [J, K] = stream_jk(*store, P.data(), m_n, m_n_threads);
+            using tensorwrapper::utilities::make_tensor;
+            return return_type{make_tensor({m_n, m_n}, J),
+                               make_tensor({m_n, m_n}, K)};
+        }
+    }
+
+    template<typename FloatType>
+    std::shared_ptr<const store_type<FloatType>> get_store_() {
+        // The most recent store and every input that went into it
+        static SetupCache cache;
+        SetupKey key{basis_fingerprint(m_aos),
+                     &m_submods.at(int_key).value(), typeid(FloatType),
+                     {m_thresh, double(m_budget)}, m_scratch.string()};
+        return cache.get<store_type<FloatType>>(key, [&]() {
+            auto store = std::make_shared<store_type<FloatType>>(
+              m_budget * bytes_per_mib, m_scratch);
+            fill_store_(*store);
+            return store;
+        });
+    }
+
+#ifdef BUILD_TAMM_SCF
+    static constexpr const char* int_key = "Schwarz factors";
+
+    template<typename FloatType>
+    void fill_store_(store_type<FloatType>& store) {
+        utilities::initialize_libint();
+        auto basis = utilities::make_libint_basis(m_aos.ao_basis_set());
+        if(basis.nbf() != m_n)
+            throw std::runtime_error("Density is not in the AO basis");
+
+        using tensorwrapper::buffer::get_raw_data;
+        using tensorwrapper::buffer::make_contiguous;
+        auto& q_mod          = m_submods.at(int_key);
+        const auto& Q_tensor = q_mod.run_as<SchwarzFactors>(m_aos);
+        const auto& Q_buffer = make_contiguous(Q_tensor.buffer());
+        auto Q_data          = get_raw_data<double>(Q_buffer);
+        std::vector<double> Q(Q_data.begin(), Q_data.end());
+        pack_quartets(store, basis, Q, m_thresh);
+    }
+#else
+    static constexpr const char* int_key = "ERI4";
+
+    template<typename FloatType>
+    void fill_store_(store_type<FloatType>& store) {
+        simde::type::aos_squared aos2(m_aos, m_aos);
+        simde::type::v_ee_type v_ee;
+        chemist::braket::BraKet mnls(aos2, v_ee, aos2);
+        const auto eri = m_submods.at(int_key).run_as<simde::ERI4>(mnls);
+
+        using tensorwrapper::buffer::make_contiguous;
+        using tensorwrapper::buffer::visit_contiguous_buffer;
+        const auto& eri_buffer = make_contiguous(eri.buffer());
+        if(eri_buffer.shape().extent(0) != m_n)
+            throw std::runtime_error(
+              "Density and ERIs have different AO bases");
+        Packer<FloatType> packer{store, m_n, m_thresh};
+        visit_contiguous_buffer(packer, eri_buffer);
+    }
+#endif
+};
+
+} // namespace
+
+using pt = JKDriver;
+
+MODULE_CTOR(ConventionalJK) {
+    description(desc);
+    satisfies_property_type<pt>();
+#ifdef BUILD_TAMM_SCF
+    add_submodule<SchwarzFactors>("Schwarz factors");
+#else
+    add_submodule<simde::ERI4>("ERI4");
+#endif
+
+    add_input<double>("screening threshold")
+      .set_default(1.0E-12)
+      .set_description("Integrals smaller than this are not stored");
+    add_input<std::size_t>("memory budget")
+      .set_default(std::size_t{1024})
+      .set_description("MiB of integrals to keep in memory before spilling "
+                       "them to a memory-mapped file");
+    add_input<std::string>("scratch directory")
+      .set_default(std::string{})
+      .set_description("Where to put the memory-mapped file");
+    add_input<std::size_t>("max threads")
+      .set_default(std::size_t{0})
+      .set_description("Maximum number of threads (0 means all)");
+}
+
+MODULE_RUN(ConventionalJK) {
+    const auto& [aos, P] = pt::unwrap_inputs(inputs);
+    const auto thresh    = inputs.at("screening threshold").value<double>();
+    const auto budget    = inputs.at("memory budget").value<std::size_t>();
+    const auto n_threads = inputs.at("max threads").value<std::size_t>();
+
+    auto scratch = inputs.at("scratch directory").value<std::string>();
+
+    std::filesystem::path scratch_dir(scratch);
+    if(scratch.empty()) scratch_dir = std::filesystem::temp_directory_path();
+
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& p_buffer = make_contiguous(P.buffer());
+    const auto n         = p_buffer.shape().extent(0);
+    if(n > store_type<double>::max_aos)
+        throw std::runtime_error("Conventional J and K: too many AOs");
+
+    Kernel kernel{n,      aos,         submods,  thresh,
+                  budget, scratch_dir, n_threads};
+    auto [J, K] = visit_contiguous_buffer(kernel, p_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, J, K);
+}
+
+} // namespace scf::jk
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jk.hpp"
+
+namespace scf::jk {
+namespace {
+const auto desc = R"(
+Coulomb Matrix via JK Driver
+----------------------------
+
+Returns the J matrix computed by the "JK driver" submodule. The K matrix of
+the same density comes from the same driver call, so when both are requested
+the memoized driver result is reused instead of making a second pass over the
+two-electron integrals.
+)";
+}
+
+using pt = simde::aos_j_e_aos;
+
+MODULE_CTOR(JViaDriver) {
+    satisfies_property_type<pt>();
+    description(desc);
+
+    add_submodule<JKDriver>("JK driver");
+}
+
+MODULE_RUN(JViaDriver) {
+    const auto& [braket] = pt::unwrap_inputs(inputs);
+
+    const auto& bra_aos = braket.bra();
+    const auto& j_op    = braket.op();
+    const auto& ket_aos = braket.ket();
+
+    if(bra_aos != ket_aos)
+        throw std::runtime_error("Expected the same basis set!");
+
+    const auto& P = j_op.get_rhs_particle();
+
+    auto& driver       = submods.at("JK driver");
+    const auto& [J, K] = driver.run_as<JKDriver>(bra_aos, P.value());
+
+    auto rv = results();
+    return pt::wrap_results(rv, J);
+}
+
+} // namespace scf::jk
@@ -0,0 +1,242 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef BUILD_TAMM_SCF
+#include "../utilities/libint_basis.hpp"
+#include "../utilities/parallel_for.hpp"
+#include "jk.hpp"
+#include "jk_scatter.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace scf::jk {
+namespace {
+
+const auto desc = R"(
+Screened Direct J and K
+-----------------------
+
+Builds J and K directly from shell quartets computed on the fly with libint2.
+
+1. The Schwarz factors Q_ab = max sqrt|(ij|ij)|, i in shell a and j in
+   shell b, come from the "Schwarz factors" submodule (memoized, so they are
+   computed once per basis set).
+2. Shell pairs with Q_ab Q_max below "screening threshold" are dropped and
+   the rest are sorted by decreasing Q_ab.
+3. A quartet (ab|cd) is skipped unless Q_ab Q_cd D_max reaches the threshold,
+   where D_max is the largest norm of the density blocks it contracts with
+   (ab, cd, ac, ad, bc, bd).
+4. Bra pairs are handed out dynamically to up to "max threads" workers, each
+   with its own engine and J/K accumulators.
+
+Only symmetry-unique quartets are computed and each contributes to both J and
+K. P is assumed to be symmetric.
+)";
+
+using basis_type = libint2::BasisSet;
+
+libint2::Engine make_engine(const basis_type& basis) {
+    return libint2::Engine(libint2::Operator::coulomb, basis.max_nprim(),
+                           basis.max_l(), 0);
+}
+
+// max |P_ij| over the block of each shell pair
+std::vector<double> block_norms(const std::vector<double>& P, std::size_t n,
+                                const basis_type& basis) {
+    const auto n_shells = basis.size();
+    const auto s2bf     = basis.shell2bf();
+    std::vector<double> D(n_shells * n_shells, 0.0);
+    for(std::size_t a = 0; a < n_shells; ++a) {
+        for(std::size_t b = 0; b < n_shells; ++b) {
+            double d = 0.0;
+            for(std::size_t i = 0; i < basis[a].size(); ++i) {
+                const auto* row = P.data() + (s2bf[a] + i) * n + s2bf[b];
+                for(std::size_t j = 0; j < basis[b].size(); ++j)
+                    d = std::max(d, std::fabs(row[j]));
+            }
+            D[a * n_shells + b] = d;
+        }
+    }
+    return D;
+}
+
+struct ShellPair {
+    std::size_t a;
+    std::size_t b;
+    double q;
+};
+
+struct Kernel {
+    using return_type = std::tuple<simde::type::tensor, simde::type::tensor>;
+
+    const basis_type& m_basis;
+    const std::vector<double>& m_Q;
+    double m_thresh;
+    std::size_t m_max_threads;
+
+    template<typename FloatType>
+    return_type operator()(const std::span<FloatType>& P_in) {
+        using clean_t = std::decay_t<FloatType>;
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error("Direct J and K: UQ types not supported");
+        } else {
+            const auto n = m_basis.nbf();
+            std::vector<double> P(P_in.begin(), P_in.end());
+            auto [J, K]  = build_(P, n);
+
+            std::vector<clean_t> J_out(J.begin(), J.end());
+            std::vector<clean_t> K_out(K.begin(), K.end());
+            using tensorwrapper::utilities::make_tensor;
+            return return_type{make_tensor({n, n}, J_out),
+                               make_tensor({n, n}, K_out)};
+        }
+    }
+
+    std::tuple<std::vector<double>, std::vector<double>> build_(
+      const std::vector<double>& P, std::size_t n) const {
+        const auto& basis   = m_basis;
+        const auto n_shells = basis.size();
+        const auto s2bf     = basis.shell2bf();
+        const auto& Q       = m_Q;
+        const auto D        = block_norms(P, n, basis);
+
+        // Significant shell pairs, largest bound first
+        const auto q_max =
+          Q.empty() ? 0.0 : *std::max_element(Q.begin(), Q.end());
+        std::vector<ShellPair> pairs;
+        for(std::size_t a = 0; a < n_shells; ++a)
+            for(std::size_t b = 0; b <= a; ++b) {
+                const auto q = Q[a * n_shells + b];
+                if(q * q_max >= m_thresh) pairs.push_back({a, b, q});
+            }
+        std::sort(pairs.begin(), pairs.end(),
+                  [](const auto& x, const auto& y) { return x.q > y.q; });
+
+        std::vector<double> J(n * n, 0.0);
+        std::vector<double> K(n * n, 0.0);
+        std::mutex reduce_mutex;
+        std::atomic<std::size_t> next_bra{0};
+
+        auto d_norm = [&](std::size_t x, std::size_t y) {
+            return D[x * n_shells + y];
+        };
+
+        auto worker = [&](std::size_t, std::size_t) {
+            auto engine     = make_engine(basis);
+            const auto& buf = engine.results();
+            std::vector<double> J_t(n * n, 0.0);
+            std::vector<double> K_t(n * n, 0.0);
+
+            for(auto p = next_bra++; p < pairs.size(); p = next_bra++) {
+                const auto [a, b, q_ab] = pairs[p];
+                for(std::size_t r = 0; r <= p; ++r) {
+                    const auto [c, d, q_cd] = pairs[r];
+                    const auto d_max =
+                      std::max({d_norm(a, b), d_norm(c, d), d_norm(a, c),
+                                d_norm(a, d), d_norm(b, c), d_norm(b, d)});
+                    if(q_ab * q_cd * d_max < m_thresh) continue;
+
+                    engine.compute(basis[a], basis[b], basis[c], basis[d]);
+                    const auto* abcd = buf[0];
+                    if(abcd == nullptr) continue;
+
+                    const auto deg = quartet_degeneracy(a == b, c == d, p == r);
+
+                    const auto na = basis[a].size();
+                    const auto nb = basis[b].size();
+                    const auto nc = basis[c].size();
+                    const auto nd = basis[d].size();
+                    std::size_t f = 0;
+                    for(std::size_t i = s2bf[a]; i < s2bf[a] + na; ++i)
+                        for(std::size_t j = s2bf[b]; j < s2bf[b] + nb; ++j)
+                            for(std::size_t k = s2bf[c]; k < s2bf[c] + nc; ++k)
+                                for(std::size_t l = s2bf[d]; l < s2bf[d] + nd;
+                                    ++l, ++f)
+                                    scatter_jk(i, j, k, l, abcd[f] * deg,
+                                               P.data(), n, J_t.data(),
+                                               K_t.data());
+                }
+            }
+
+            std::lock_guard lock(reduce_mutex);
+            for(std::size_t x = 0; x < n * n; ++x) {
+                J[x] += J_t[x];
+                K[x] += K_t[x];
+            }
+        };
+
+        // One work item per thread; the items pull bra pairs off next_bra
+        auto n_threads = m_max_threads;
+        if(n_threads == 0) n_threads = utilities::default_n_threads();
+        utilities::parallel_for(n_threads, worker, n_threads);
+        symmetrize_jk(J, K, n);
+        return {std::move(J), std::move(K)};
+    }
+};
+
+} // namespace
+
+using pt = JKDriver;
+
+MODULE_CTOR(DirectJK) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<SchwarzFactors>("Schwarz factors");
+
+    add_input<double>("screening threshold")
+      .set_default(1.0E-12)
+      .set_description("Quartets whose contribution is bounded below this "
+                       "are skipped");
+    add_input<std::size_t>("max threads")
+      .set_default(std::size_t{0})
+      .set_description("Maximum number of threads (0 means all)");
+}
+
+MODULE_RUN(DirectJK) {
+    const auto& [aos, P] = pt::unwrap_inputs(inputs);
+    const auto thresh    = inputs.at("screening threshold").value<double>();
+    const auto n_threads = inputs.at("max threads").value<std::size_t>();
+
+    utilities::initialize_libint();
+    auto basis = utilities::make_libint_basis(aos.ao_basis_set());
+
+    using tensorwrapper::buffer::get_raw_data;
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& p_buffer = make_contiguous(P.buffer());
+    if(p_buffer.shape().extent(0) != basis.nbf())
+        throw std::runtime_error("Density is not in the AO basis");
+
+    auto& q_mod          = submods.at("Schwarz factors");
+    const auto& Q_tensor = q_mod.run_as<SchwarzFactors>(aos);
+    const auto& Q_buffer = make_contiguous(Q_tensor.buffer());
+    auto Q_data          = get_raw_data<double>(Q_buffer);
+    std::vector<double> Q(Q_data.begin(), Q_data.end());
+
+    Kernel kernel{basis, Q, thresh, n_threads};
+    auto [J, K] = visit_contiguous_buffer(kernel, p_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, J, K);
+}
+
+} // namespace scf::jk
+#endif
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../utilities/parallel_for.hpp"
+#include "jk.hpp"
+#include "jk_scatter.hpp"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace scf::jk {
+namespace {
+
+const auto desc = R"(
+Fused J and K
+-------------
+
+Builds the Coulomb (J) and exchange (K) matrices of an AO density matrix P in
+a single pass over the two-electron integrals, which come from the "ERI4"
+submodule. Only the symmetry-unique integrals (ij|kl) with i >= j, k >= l,
+and ij >= kl are visited; each one is scattered into both J and K:
+
+.. math::
+
+   J_{ij} \mathrel{+}= d (ij|kl) P_{kl}, \quad
+   J_{kl} \mathrel{+}= d (ij|kl) P_{ij}, \quad
+   K_{ik} \mathrel{+}= d (ij|kl) P_{jl}, \ldots
+
+where d is the permutational degeneracy of the integral. J and K are then
+symmetrized. P is assumed to be symmetric.
+
+The bra pairs ij are handed out to up to "max threads" threads, each of which
+accumulates into its own J and K. This module needs the full n^4 ERI tensor,
+so it is meant for small systems, testing, and builds without libint2. When
+libint2 is available the SCF integral driver instead builds J and K in one
+pass over screened shell quartets with "Direct J and K".
+)";
+
+// Scatters the unique (ij|kl) of a row-major n^4 ERI tensor into J and K
+struct FusedKernel {
+    using return_type = std::tuple<simde::type::tensor, simde::type::tensor>;
+
+    std::size_t m_n;
+    const tensorwrapper::buffer::Contiguous& m_P;
+    std::size_t m_max_threads;
+
+    template<typename FloatType>
+    return_type operator()(const std::span<FloatType>& eri) {
+        using clean_t = std::decay_t<FloatType>;
+        using tensorwrapper::buffer::get_raw_data;
+        const auto n = m_n;
+        auto P       = get_raw_data<clean_t>(m_P);
+
+        auto idx = [n](std::size_t i, std::size_t j, std::size_t k,
+                       std::size_t l) { return ((i * n + j) * n + k) * n + l; };
+
+        // Unique pairs ij (i >= j) in the order of their compound index
+        std::vector<std::pair<std::size_t, std::size_t>> pairs;
+        pairs.reserve(n * (n + 1) / 2);
+        for(std::size_t i = 0; i < n; ++i)
+            for(std::size_t j = 0; j <= i; ++j) pairs.emplace_back(i, j);
+
+        std::vector<clean_t> J(n * n, clean_t(0.0));
+        std::vector<clean_t> K(n * n, clean_t(0.0));
+        std::mutex reduce_mutex;
+        std::atomic<std::size_t> next_bra{0};
+
+        // The work per bra pair grows with ij, so pairs are pulled one at a
+        // time rather than split into fixed chunks
+        auto worker = [&](std::size_t, std::size_t) {
+            std::vector<clean_t> J_t(n * n, clean_t(0.0));
+            std::vector<clean_t> K_t(n * n, clean_t(0.0));
+            for(auto ij = next_bra++; ij < pairs.size(); ij = next_bra++) {
+                const auto [i, j] = pairs[ij];
+                for(std::size_t kl = 0; kl <= ij; ++kl) {
+                    const auto [k, l] = pairs[kl];
+                    const auto deg    = quartet_degeneracy(i == j, k == l,
+                                                           ij == kl);
+                    const auto v      = eri[idx(i, j, k, l)] * clean_t(deg);
+                    scatter_jk(i, j, k, l, v, P.data(), n, J_t.data(),
+                               K_t.data());
+                }
+            }
+
+            std::lock_guard lock(reduce_mutex);
+            for(std::size_t x = 0; x < n * n; ++x) {
+                J[x] += J_t[x];
+                K[x] += K_t[x];
+            }
+        };
+
+        // One work item per thread; the items pull bra pairs off next_bra
+        auto n_threads = m_max_threads;
+        if(n_threads == 0) n_threads = utilities::default_n_threads();
+        n_threads = std::max<std::size_t>(1, std::min(n_threads, pairs.size()));
+        utilities::parallel_for(n_threads, worker, n_threads);
+        symmetrize_jk(J, K, n);
+
+        using tensorwrapper::utilities::make_tensor;
+        return return_type{make_tensor({n, n}, J), make_tensor({n, n}, K)};
+    }
+};
+
+} // namespace
+
+using pt     = JKDriver;
+using eri_pt = simde::ERI4;
+
+MODULE_CTOR(FusedJK) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<eri_pt>("ERI4");
+
+    add_input<std::size_t>("max threads")
+      .set_default(std::size_t{0})
+      .set_description("Maximum number of threads (0 means all)");
+}
+
+MODULE_RUN(FusedJK) {
+    const auto& [aos, P] = pt::unwrap_inputs(inputs);
+    const auto n_threads = inputs.at("max threads").value<std::size_t>();
+
+    simde::type::aos_squared aos2(aos, aos);
+    simde::type::v_ee_type v_ee;
+    chemist::braket::BraKet mnls(aos2, v_ee, aos2);
+    const auto& eri = submods.at("ERI4").run_as<eri_pt>(mnls);
+
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& eri_buffer = make_contiguous(eri.buffer());
+    const auto& p_buffer   = make_contiguous(P.buffer());
+    const auto n           = p_buffer.shape().extent(0);
+    if(eri_buffer.shape().extent(0) != n)
+        throw std::runtime_error("Density and ERIs have different AO bases");
+
+    FusedKernel kernel{n, p_buffer, n_threads};
+    auto [J, K] = visit_contiguous_buffer(kernel, eri_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, J, K);
+}
+
+} // namespace scf::jk
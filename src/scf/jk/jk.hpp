@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "jk_property_types.hpp"
+#include <simde/simde.hpp>
+
+namespace scf::jk {
+
+DECLARE_MODULE(CholeskyJK);
+#ifdef BUILD_TAMM_SCF
+DECLARE_MODULE(CFMMJ);
+DECLARE_MODULE(DirectJK);
+DECLARE_MODULE(SchwarzFactorsBuilder);
+#endif
+DECLARE_MODULE(ConventionalJK);
+DECLARE_MODULE(FusedJK);
+DECLARE_MODULE(JViaDriver);
+DECLARE_MODULE(KViaDriver);
+DECLARE_MODULE(RIFactorsBuilder);
+DECLARE_MODULE(RIJ);
+DECLARE_MODULE(RIK);
+
+inline void load_modules(pluginplay::ModuleManager& mm) {
+    mm.add_module<CholeskyJK>("Cholesky J and K");
+#ifdef BUILD_TAMM_SCF
+    mm.add_module<CFMMJ>("CFMM J");
+    mm.add_module<DirectJK>("Direct J and K");
+    mm.add_module<SchwarzFactorsBuilder>("Schwarz factors");
+#endif
+    mm.add_module<ConventionalJK>("Conventional J and K");
+    mm.add_module<FusedJK>("Fused J and K");
+    mm.add_module<JViaDriver>("J via JK driver");
+    mm.add_module<KViaDriver>("K via JK driver");
+    mm.add_module<RIFactorsBuilder>("RI factors");
+    mm.add_module<RIJ>("RI-J");
+    mm.add_module<RIK>("RI-K");
+}
+
+inline void set_defaults(pluginplay::ModuleManager& mm) {
+#ifdef BUILD_TAMM_SCF
+    const auto jk_driver = "Direct J and K";
+#else
+    const auto jk_driver = "Fused J and K";
+#endif
+    mm.change_submod("J via JK driver", "JK driver", jk_driver);
+    mm.change_submod("K via JK driver", "JK driver", jk_driver);
+    mm.change_submod("RI-J", "RI factors", "RI factors");
+    mm.change_submod("RI-K", "RI factors", "RI factors");
+#ifdef BUILD_TAMM_SCF
+    mm.change_submod("Direct J and K", "Schwarz factors", "Schwarz factors");
+    mm.change_submod("Conventional J and K", "Schwarz factors",
+                     "Schwarz factors");
+#endif
+}
+
+} // namespace scf::jk
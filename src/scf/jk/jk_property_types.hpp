@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <simde/simde.hpp>
+
+namespace scf::jk {
+
+/** @brief Builds the Coulomb and exchange matrices of a density together.
+ *
+ *  For the AO density matrix P, J_mn = sum_ls (mn|ls) P_ls and
+ *  K_mn = sum_ls (ml|ns) P_ls. Builders satisfying this property type produce
+ *  both from one pass over the two-electron integrals (or their
+ *  factorization).
+ */
+DECLARE_PROPERTY_TYPE(JKDriver);
+
+PROPERTY_TYPE_INPUTS(JKDriver) {
+    using aos_type    = simde::type::aos;
+    using tensor_type = simde::type::tensor;
+    auto rv           = pluginplay::declare_input()
+                .add_field<const aos_type&>("AOs")
+                .add_field<const tensor_type&>("density");
+    return rv;
+}
+
+PROPERTY_TYPE_RESULTS(JKDriver) {
+    using tensor_type = simde::type::tensor;
+    auto rv           = pluginplay::declare_result()
+                .add_field<tensor_type>("J")
+                .add_field<tensor_type>("K");
+    return rv;
+}
+
+/** @brief Computes the fitted three-center factors of density fitting.
+ *
+ *  With V_PQ = (P|Q) the Coulomb metric of the auxiliary basis and
+ *  V = L L^T its Cholesky factorization, the result is the
+ *  n_aux by n by n tensor B = L^-1 (Q|mn), so that
+ *  (mn|ls) ~ sum_Q B_Qmn B_Qls.
+ */
+DECLARE_PROPERTY_TYPE(RIFactors);
+
+PROPERTY_TYPE_INPUTS(RIFactors) {
+    using aos_type = simde::type::aos;
+    auto rv        = pluginplay::declare_input()
+                .add_field<const aos_type&>("AOs")
+                .add_field<const aos_type&>("Auxiliary AOs");
+    return rv;
+}
+
+PROPERTY_TYPE_RESULTS(RIFactors) {
+    using tensor_type = simde::type::tensor;
+    auto rv = pluginplay::declare_result().add_field<tensor_type>("B");
+    return rv;
+}
+
+/** @brief Computes the Schwarz factors of every pair of shells.
+ *
+ *  The result is the n_shells by n_shells tensor Q with
+ *  Q_ab = max sqrt|(ij|ij)| over functions i in shell a and j in shell b, so
+ *  that |(ij|kl)| <= Q_ab Q_cd. Q only depends on the basis set.
+ */
+DECLARE_PROPERTY_TYPE(SchwarzFactors);
+
+PROPERTY_TYPE_INPUTS(SchwarzFactors) {
+    using aos_type = simde::type::aos;
+    auto rv = pluginplay::declare_input().add_field<const aos_type&>("AOs");
+    return rv;
+}
+
+PROPERTY_TYPE_RESULTS(SchwarzFactors) {
+    using tensor_type = simde::type::tensor;
+    auto rv = pluginplay::declare_result().add_field<tensor_type>("Q");
+    return rv;
+}
+
+} // namespace scf::jk
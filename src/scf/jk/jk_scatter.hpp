@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace scf::jk {
+
+/** @brief Permutational degeneracy of a symmetry-unique integral (ij|kl).
+ *
+ *  @param[in] same_ij Are i and j the same (function or shell)?
+ *  @param[in] same_kl Are k and l the same?
+ *  @param[in] same_pair Are the pairs ij and kl the same?
+ */
+inline double quartet_degeneracy(bool same_ij, bool same_kl, bool same_pair) {
+    double deg = (same_ij ? 1.0 : 2.0);
+    deg *= (same_kl ? 1.0 : 2.0);
+    deg *= (same_pair ? 1.0 : 2.0);
+    return deg;
+}
+
+/** @brief Adds a symmetry-unique integral to row-major n by n J and K.
+ *
+ *  @p v is (ij|kl) already multiplied by its degeneracy. Only one of each
+ *  pair of symmetric elements of J and K (or one half of its contribution)
+ *  is written, so once all integrals are in, symmetrize_jk() must be called.
+ *  P is assumed to be symmetric.
+ */
+template<typename FloatType>
+void scatter_jk(std::size_t i, std::size_t j, std::size_t k, std::size_t l,
+                FloatType v, const FloatType* P, std::size_t n, FloatType* J,
+                FloatType* K) {
+    J[i * n + j] += P[k * n + l] * v;
+    J[k * n + l] += P[i * n + j] * v;
+    K[i * n + k] += P[j * n + l] * v;
+    K[j * n + l] += P[i * n + k] * v;
+    K[i * n + l] += P[j * n + k] * v;
+    K[j * n + k] += P[i * n + l] * v;
+}
+
+/// Turns the J and K accumulated with scatter_jk() into the final matrices
+template<typename FloatType>
+void symmetrize_jk(std::vector<FloatType>& J, std::vector<FloatType>& K,
+                   std::size_t n) {
+    for(std::size_t i = 0; i < n; ++i) {
+        for(std::size_t j = 0; j <= i; ++j) {
+            const auto ij = i * n + j;
+            const auto ji = j * n + i;
+            J[ij] = J[ji] = (J[ij] + J[ji]) * FloatType(0.25);
+            K[ij] = K[ji] = (K[ij] + K[ji]) * FloatType(0.125);
+        }
+    }
+}
+
+} // namespace scf::jk
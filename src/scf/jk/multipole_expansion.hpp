@@ -0,0 +1,196 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace scf::jk {
+
+/** @brief Cartesian Taylor expansions of the Coulomb interaction.
+ *
+ *  Components are the multi-indices a = (a_x, a_y, a_z) with |a| at most
+ *  max_order, ordered by |a| and then with decreasing powers of x and y
+ *  (i.e., 1, x, y, z, xx, xy, xz, yy, yz, zz, ...), which matches libint's
+ *  multipole integrals. Multipoles are raw moments, M_a = sum_i q_i r_i^a,
+ *  and local expansions hold the derivatives of the potential, so
+ *  phi(T + x) = sum_a L_a x^a / a!. All interactions are truncated at total
+ *  order max_order.
+ */
+class CartesianExpansion {
+public:
+    using index_type  = std::array<unsigned, 3>;
+    using point_type  = std::array<double, 3>;
+    using vector_type = std::vector<double>;
+
+    explicit CartesianExpansion(unsigned max_order) : m_max_order_(max_order) {
+        for(unsigned n = 0; n <= max_order; ++n)
+            for(unsigned i = n + 1; i-- > 0;)
+                for(unsigned j = n - i + 1; j-- > 0;)
+                    m_indices_.push_back({i, j, n - i - j});
+        for(const auto& a : m_indices_)
+            m_inv_factorial_.push_back(
+              1.0 / (factorial_(a[0]) * factorial_(a[1]) * factorial_(a[2])));
+    }
+
+    unsigned max_order() const noexcept { return m_max_order_; }
+    std::size_t size() const noexcept { return m_indices_.size(); }
+    const index_type& index(std::size_t i) const { return m_indices_[i]; }
+    double inverse_factorial(std::size_t i) const {
+        return m_inv_factorial_[i];
+    }
+
+    /// Number of components with total order below @p n
+    static std::size_t offset(unsigned n) noexcept {
+        return std::size_t(n) * (n + 1) * (n + 2) / 6;
+    }
+
+    /// Position of @p a (which must have |a| <= max_order)
+    static std::size_t position(const index_type& a) noexcept {
+        const std::size_t n = a[0] + a[1] + a[2];
+        const std::size_t r = n - a[0];
+        return offset(n) + r * (r + 1) / 2 + (r - a[1]);
+    }
+
+    /** @brief D_a = d^a (1/|R|) for every component.
+     *
+     *  Uses the McMurchie-Davidson recursion for point charges,
+     *  R^n_{a + e_x} = a_x R^{n+1}_{a - e_x} + X R^{n+1}_a, starting from
+     *  R^n_0 = (-1)^n (2n - 1)!! / |R|^(2n + 1).
+     */
+    vector_type coulomb_derivatives(const point_type& R) const {
+        const auto p      = m_max_order_;
+        const auto n_comp = size();
+        const double r2   = R[0] * R[0] + R[1] * R[1] + R[2] * R[2];
+        const double r    = std::sqrt(r2);
+
+        // table[n * n_comp + position(a)] = R^n_a, needed for |a| + n <= p
+        vector_type table((p + 1) * n_comp, 0.0);
+        double g = 1.0 / r;
+        for(unsigned n = 0; n <= p; ++n) {
+            table[n * n_comp] = g;
+            g *= -double(2 * n + 1) / r2;
+        }
+        for(std::size_t c = 1; c < n_comp; ++c) {
+            const auto& a        = m_indices_[c];
+            const unsigned order = a[0] + a[1] + a[2];
+            const unsigned d     = a[0] ? 0 : (a[1] ? 1 : 2);
+            auto lower           = a;
+            --lower[d];
+            const auto c1 = position(lower);
+            for(unsigned n = 0; n + order <= p; ++n) {
+                double value = R[d] * table[(n + 1) * n_comp + c1];
+                if(lower[d] > 0) {
+                    auto lower2 = lower;
+                    --lower2[d];
+                    const auto c2 = position(lower2);
+                    value += lower[d] * table[(n + 1) * n_comp + c2];
+                }
+                table[n * n_comp + c] = value;
+            }
+        }
+        return vector_type(table.begin(), table.begin() + n_comp);
+    }
+
+    /// Multipoles about a new center, where @p d is old minus new center
+    vector_type translate_multipoles(const vector_type& M,
+                                     const point_type& d) const {
+        vector_type rv(size(), 0.0);
+        for(std::size_t b = 0; b < size(); ++b) {
+            const auto& beta = m_indices_[b];
+            for(std::size_t g = 0; g < size(); ++g) {
+                const auto& gamma = m_indices_[g];
+                if(gamma[0] > beta[0] || gamma[1] > beta[1] ||
+                   gamma[2] > beta[2])
+                    continue;
+                double term = M[g];
+                for(unsigned x = 0; x < 3; ++x)
+                    term *= binomial_(beta[x], gamma[x]) *
+                            std::pow(d[x], int(beta[x] - gamma[x]));
+                rv[b] += term;
+            }
+        }
+        return rv;
+    }
+
+    /** @brief Adds the local expansion of multipoles @p M to @p L.
+     *
+     *  @p R is the local expansion's center minus the multipoles' center.
+     */
+    void multipoles_to_local(const vector_type& M, const point_type& R,
+                             vector_type& L) const {
+        const auto D = coulomb_derivatives(R);
+        for(std::size_t a = 0; a < size(); ++a) {
+            const auto& alpha  = m_indices_[a];
+            const unsigned n_a = alpha[0] + alpha[1] + alpha[2];
+            for(std::size_t b = 0; b < offset(m_max_order_ - n_a + 1); ++b) {
+                const auto& beta   = m_indices_[b];
+                const unsigned n_b = beta[0] + beta[1] + beta[2];
+                const double sign  = n_b % 2 ? -1.0 : 1.0;
+                const index_type ab{alpha[0] + beta[0], alpha[1] + beta[1],
+                                    alpha[2] + beta[2]};
+                L[a] += sign * M[b] * m_inv_factorial_[b] * D[position(ab)];
+            }
+        }
+    }
+
+    /// The local expansion about a new center, where @p d is new minus old
+    vector_type translate_local(const vector_type& L,
+                                const point_type& d) const {
+        vector_type rv(size(), 0.0);
+        for(std::size_t a = 0; a < size(); ++a) {
+            const auto& alpha  = m_indices_[a];
+            const unsigned n_a = alpha[0] + alpha[1] + alpha[2];
+            for(std::size_t g = 0; g < offset(m_max_order_ - n_a + 1); ++g) {
+                const auto& gamma = m_indices_[g];
+                const index_type ag{alpha[0] + gamma[0], alpha[1] + gamma[1],
+                                    alpha[2] + gamma[2]};
+                double term = L[position(ag)] * m_inv_factorial_[g];
+                for(unsigned x = 0; x < 3; ++x)
+                    term *= std::pow(d[x], int(gamma[x]));
+                rv[a] += term;
+            }
+        }
+        return rv;
+    }
+
+    /// Interaction energy of multipoles @p M, about L's center, with @p L
+    double contract(const vector_type& L, const double* M) const {
+        double rv = 0.0;
+        for(std::size_t a = 0; a < size(); ++a)
+            rv += L[a] * M[a] * m_inv_factorial_[a];
+        return rv;
+    }
+
+private:
+    static double factorial_(unsigned n) {
+        double rv = 1.0;
+        for(unsigned i = 2; i <= n; ++i) rv *= i;
+        return rv;
+    }
+
+    static double binomial_(unsigned n, unsigned k) {
+        return factorial_(n) / (factorial_(k) * factorial_(n - k));
+    }
+
+    unsigned m_max_order_;
+    std::vector<index_type> m_indices_;
+    vector_type m_inv_factorial_;
+};
+
+} // namespace scf::jk
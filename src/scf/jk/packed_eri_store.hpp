@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "scratch_file.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace scf::jk {
+
+/// One stored integral (ij|kl) and its AO indices
+template<typename FloatType>
+struct PackedERI {
+    std::array<std::uint16_t, 4> index;
+    FloatType value;
+};
+
+/** @brief Append-only storage for the symmetry-unique ERIs.
+ *
+ *  Records are kept in memory until they would exceed the memory budget.
+ *  From then on they are spilled, in budget-sized (but at least 1 MiB)
+ *  writes, to an unlinked scratch file, which finalize() maps read-only.
+ *  Either way data() is one contiguous array of records, meant to be
+ *  streamed through front to back.
+ *
+ *  @tparam FloatType The type of the integrals.
+ */
+template<typename FloatType>
+class PackedERIStore {
+public:
+    using record_type = PackedERI<FloatType>;
+    using size_type   = std::size_t;
+
+    /// Largest number of AOs whose indices fit in a record
+    static constexpr size_type max_aos =
+      std::size_t(std::numeric_limits<std::uint16_t>::max()) + 1;
+
+    /** @brief Creates an empty store.
+     *
+     *  @param[in] budget The most bytes of records to hold in memory.
+     *  @param[in] dir Where to create the scratch file, if one is needed.
+     */
+    PackedERIStore(size_type budget, std::filesystem::path dir) :
+      m_capacity_(budget / sizeof(record_type)), m_dir_(std::move(dir)) {}
+
+    PackedERIStore(const PackedERIStore&)            = delete;
+    PackedERIStore& operator=(const PackedERIStore&) = delete;
+
+    ~PackedERIStore() noexcept {
+        if(m_pmap_ != nullptr) scratch::unmap(m_pmap_, m_size_ * record_size);
+        if(m_fd_ >= 0) ::close(m_fd_);
+    }
+
+    /// Number of stored integrals
+    size_type size() const noexcept { return m_size_; }
+
+    /// Is the store backed by a memory-mapped file?
+    bool is_mapped() const noexcept { return m_pmap_ != nullptr; }
+
+    /// Pointer to the first record (valid after finalize())
+    const record_type* data() const noexcept {
+        return is_mapped() ? m_pmap_ : m_records_.data();
+    }
+
+    /** @brief Appends (ij|kl).
+     *
+     *  @throw std::runtime_error if the store has been finalized or if
+     *                            spilling to disk fails.
+     */
+    void push_back(size_type i, size_type j, size_type k, size_type l,
+                   FloatType value) {
+        if(m_finalized_)
+            throw std::runtime_error("Can't append to a finalized ERI store");
+        if(m_fd_ < 0 && m_records_.size() >= m_capacity_)
+            m_fd_ = scratch::open_file(m_dir_, "scf_eri");
+        if(m_fd_ >= 0 && m_records_.size() >= write_block_()) spill_();
+        m_records_.push_back(
+          record_type{{std::uint16_t(i), std::uint16_t(j), std::uint16_t(k),
+                       std::uint16_t(l)},
+                      value});
+        ++m_size_;
+    }
+
+    /// Ends appending and, if anything was spilled, maps the file
+    void finalize() {
+        if(m_finalized_) return;
+        m_finalized_ = true;
+        if(m_fd_ < 0) return;
+        spill_();
+        if(m_size_ > 0) {
+            const auto* pmap = scratch::map_read_only(m_fd_, bytes_());
+            m_pmap_          = static_cast<const record_type*>(pmap);
+            scratch::advise_sequential(pmap, bytes_());
+        }
+        ::close(m_fd_);
+        m_fd_ = -1;
+    }
+
+private:
+    static constexpr size_type record_size = sizeof(record_type);
+
+    size_type bytes_() const noexcept { return m_size_ * record_size; }
+
+    size_type write_block_() const noexcept {
+        constexpr size_type min_block = (size_type(1) << 20) / record_size;
+        return std::max(m_capacity_, min_block);
+    }
+
+    void spill_() {
+        scratch::write_all(m_fd_, m_records_.data(),
+                           m_records_.size() * record_size);
+        m_records_.clear();
+    }
+
+    size_type m_capacity_;
+    std::filesystem::path m_dir_;
+    std::vector<record_type> m_records_;
+    size_type m_size_          = 0;
+    bool m_finalized_          = false;
+    int m_fd_                  = -1;
+    const record_type* m_pmap_ = nullptr;
+};
+
+} // namespace scf::jk
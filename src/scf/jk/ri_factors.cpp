@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jk.hpp"
+#include <Eigen/Dense>
+#include <stdexcept>
+#include <vector>
+
+namespace scf::jk {
+namespace {
+
+const auto desc = R"(
+Density-Fitting Factors
+-----------------------
+
+Computes B = L^-1 (Q|mn) where (Q|mn) are the three-center integrals between
+the auxiliary basis and AO pairs ("ERI3" submodule) and L is the Cholesky
+factor of the auxiliary Coulomb metric (P|Q) ("ERI2" submodule). B is
+returned as an n_aux by n by n tensor.
+
+Since this module is memoized, B is computed once per (AO basis, auxiliary
+basis) pair and then shared by every RI-J and RI-K build which uses it.
+)";
+
+struct Kernel {
+    std::size_t m_n_aux;
+    std::size_t m_n;
+
+    template<typename FloatType0, typename FloatType1>
+    simde::type::tensor operator()(const std::span<FloatType0>&,
+                                   const std::span<FloatType1>&) {
+        throw std::runtime_error("RI factors: Mixed float types not supported");
+    }
+
+    template<typename FloatType>
+    simde::type::tensor operator()(const std::span<FloatType>& metric,
+                                   const std::span<FloatType>& eri3) {
+        using clean_t = std::decay_t<FloatType>;
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error("RI factors: UQ types not supported");
+        } else {
+            constexpr auto rmajor = Eigen::RowMajor;
+            constexpr auto edynam = Eigen::Dynamic;
+            using matrix_type = Eigen::Matrix<clean_t, edynam, edynam, rmajor>;
+            using map_type    = Eigen::Map<const matrix_type>;
+
+            const auto n2 = m_n * m_n;
+            map_type V(metric.data(), m_n_aux, m_n_aux);
+            Eigen::LLT<matrix_type> llt(V);
+            if(llt.info() != Eigen::Success)
+                throw std::runtime_error(
+                  "RI factors: auxiliary metric is not positive definite");
+
+            std::vector<clean_t> B(eri3.begin(), eri3.end());
+            Eigen::Map<matrix_type> B_map(B.data(), m_n_aux, n2);
+            llt.matrixL().solveInPlace(B_map);
+
+            using tensorwrapper::utilities::make_tensor;
+            return make_tensor({m_n_aux, m_n, m_n}, B);
+        }
+    }
+};
+
+} // namespace
+
+using pt      = RIFactors;
+using eri2_pt = simde::ERI2;
+using eri3_pt = simde::ERI3;
+
+MODULE_CTOR(RIFactorsBuilder) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<eri2_pt>("ERI2");
+    add_submodule<eri3_pt>("ERI3");
+}
+
+MODULE_RUN(RIFactorsBuilder) {
+    const auto& [aos, aux] = pt::unwrap_inputs(inputs);
+
+    simde::type::v_ee_type v_ee;
+    chemist::braket::BraKet PQ(aux, v_ee, aux);
+    const auto& metric = submods.at("ERI2").run_as<eri2_pt>(PQ);
+
+    simde::type::aos_squared aos2(aos, aos);
+    chemist::braket::BraKet Qmn(aux, v_ee, aos2);
+    const auto& eri3 = submods.at("ERI3").run_as<eri3_pt>(Qmn);
+
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& metric_buffer = make_contiguous(metric.buffer());
+    const auto& eri3_buffer   = make_contiguous(eri3.buffer());
+    const auto n_aux          = metric_buffer.shape().extent(0);
+    const auto n              = eri3_buffer.shape().extent(1);
+
+    Kernel kernel{n_aux, n};
+    auto B = visit_contiguous_buffer(kernel, metric_buffer, eri3_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, B);
+}
+
+} // namespace scf::jk
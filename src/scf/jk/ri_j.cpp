@@ -0,0 +1,110 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jk.hpp"
+#include "three_index_jk.hpp"
+#include <stdexcept>
+
+namespace scf::jk {
+namespace {
+
+const auto desc = R"(
+Density-Fitted Coulomb Matrix (RI-J)
+------------------------------------
+
+Builds J from the density-fitting factors B of the "RI factors" submodule
+(computed once per basis set pair) by first fitting the density,
+
+.. math::
+
+   d_Q = \sum_{ls} B_{Qls} P_{ls}, \qquad J_{mn} = \sum_Q B_{Qmn} d_Q,
+
+which costs O(n_aux n^2) per build instead of the O(n^4) of the four-center
+algorithm. The "auxiliary basis" input must be set.
+)";
+
+struct Kernel {
+    std::size_t m_n_aux;
+    std::size_t m_n;
+
+    template<typename FloatType0, typename FloatType1>
+    simde::type::tensor operator()(const std::span<FloatType0>&,
+                                   const std::span<FloatType1>&) {
+        throw std::runtime_error("RI-J: Mixed float types not supported");
+    }
+
+    template<typename FloatType>
+    simde::type::tensor operator()(const std::span<FloatType>& B,
+                                   const std::span<FloatType>& P) {
+        using clean_t = std::decay_t<FloatType>;
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error("RI-J: UQ types not supported");
+        } else {
+            ThreeIndexJK<clean_t> jk(B.data(), m_n_aux, m_n);
+            using tensorwrapper::utilities::make_tensor;
+            return make_tensor({m_n, m_n}, jk.coulomb(P.data()));
+        }
+    }
+};
+
+} // namespace
+
+using pt = simde::aos_j_e_aos;
+
+MODULE_CTOR(RIJ) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<RIFactors>("RI factors");
+
+    add_input<simde::type::aos>("auxiliary basis")
+      .set_default(simde::type::aos{})
+      .set_description("The auxiliary basis set to fit the density in");
+}
+
+MODULE_RUN(RIJ) {
+    const auto& [braket] = pt::unwrap_inputs(inputs);
+    const auto aux = inputs.at("auxiliary basis").value<simde::type::aos>();
+
+    const auto& bra_aos = braket.bra();
+    const auto& j_op    = braket.op();
+    const auto& ket_aos = braket.ket();
+
+    if(bra_aos != ket_aos)
+        throw std::runtime_error("Expected the same basis set!");
+    if(aux == simde::type::aos{})
+        throw std::runtime_error("RI-J: an auxiliary basis set is required");
+
+    auto& factors_mod = submods.at("RI factors");
+    const auto& B     = factors_mod.run_as<RIFactors>(bra_aos, aux);
+    const auto& P     = j_op.get_rhs_particle().value();
+
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& b_buffer = make_contiguous(B.buffer());
+    const auto& p_buffer = make_contiguous(P.buffer());
+    const auto n_aux     = b_buffer.shape().extent(0);
+    const auto n         = b_buffer.shape().extent(1);
+    if(p_buffer.shape().extent(0) != n)
+        throw std::runtime_error("RI-J: density is not in the AO basis");
+
+    Kernel kernel{n_aux, n};
+    auto J = visit_contiguous_buffer(kernel, b_buffer, p_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, J);
+}
+
+} // namespace scf::jk
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jk.hpp"
+#include "three_index_jk.hpp"
+#include <stdexcept>
+
+namespace scf::jk {
+namespace {
+
+const auto desc = R"(
+Density-Fitted Exchange Matrix (RI-K)
+-------------------------------------
+
+Builds K from the density-fitting factors B of the "RI factors" submodule
+(computed once per basis set pair) with occupied-orbital-like contractions.
+The density is factored as P = X S X^T by a pivoted Cholesky decomposition
+(X then spans the occupied orbitals and S = 1), which stops once the largest
+remaining diagonal element is below "factor threshold" times the largest
+diagonal element of P. Only if P is indefinite is it diagonalized instead;
+the columns of X are then its eigenvectors scaled by the square roots of the
+eigenvalue magnitudes and S holds the eigenvalue signs. Then
+
+.. math::
+
+   T^Q = B^Q X, \qquad K = \sum_Q T^Q S (T^Q)^T = W S W^T,
+
+where W = [T^1 T^2 ...] is n by n_aux r, so K is a single matrix product. For
+an idempotent density the work is O(n_aux n^2 n_occ). The "auxiliary basis"
+input must be set.
+)";
+
+struct Kernel {
+    std::size_t m_n_aux;
+    std::size_t m_n;
+    double m_thresh;
+
+    template<typename FloatType0, typename FloatType1>
+    simde::type::tensor operator()(const std::span<FloatType0>&,
+                                   const std::span<FloatType1>&) {
+        throw std::runtime_error("RI-K: Mixed float types not supported");
+    }
+
+    template<typename FloatType>
+    simde::type::tensor operator()(const std::span<FloatType>& B,
+                                   const std::span<FloatType>& P) {
+        using clean_t = std::decay_t<FloatType>;
+        if constexpr(tensorwrapper::types::is_uq_type_v<clean_t>) {
+            throw std::runtime_error("RI-K: UQ types not supported");
+        } else {
+            ThreeIndexJK<clean_t> jk(B.data(), m_n_aux, m_n);
+            using tensorwrapper::utilities::make_tensor;
+            return make_tensor({m_n, m_n}, jk.exchange(P.data(), m_thresh));
+        }
+    }
+};
+
+} // namespace
+
+using pt = simde::aos_k_e_aos;
+
+MODULE_CTOR(RIK) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<RIFactors>("RI factors");
+
+    add_input<simde::type::aos>("auxiliary basis")
+      .set_default(simde::type::aos{})
+      .set_description("The auxiliary basis set to fit the density in");
+
+    add_input<double>("factor threshold")
+      .set_default(1.0E-12)
+      .set_description("Relative cutoff for factoring the density");
+}
+
+MODULE_RUN(RIK) {
+    const auto& [braket] = pt::unwrap_inputs(inputs);
+    const auto aux = inputs.at("auxiliary basis").value<simde::type::aos>();
+    const auto thresh = inputs.at("factor threshold").value<double>();
+
+    const auto& bra_aos = braket.bra();
+    const auto& k_op    = braket.op();
+    const auto& ket_aos = braket.ket();
+
+    if(bra_aos != ket_aos)
+        throw std::runtime_error("Expected the same basis set!");
+    if(aux == simde::type::aos{})
+        throw std::runtime_error("RI-K: an auxiliary basis set is required");
+
+    auto& factors_mod = submods.at("RI factors");
+    const auto& B     = factors_mod.run_as<RIFactors>(bra_aos, aux);
+    const auto& P     = k_op.get_rhs_particle().value();
+
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& b_buffer = make_contiguous(B.buffer());
+    const auto& p_buffer = make_contiguous(P.buffer());
+    const auto n_aux     = b_buffer.shape().extent(0);
+    const auto n         = b_buffer.shape().extent(1);
+    if(p_buffer.shape().extent(0) != n)
+        throw std::runtime_error("RI-K: density is not in the AO basis");
+
+    Kernel kernel{n_aux, n, thresh};
+    auto K = visit_contiguous_buffer(kernel, b_buffer, p_buffer);
+
+    auto rv = results();
+    return pt::wrap_results(rv, K);
+}
+
+} // namespace scf::jk
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef BUILD_TAMM_SCF
+#include "../utilities/libint_basis.hpp"
+#include "jk.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace scf::jk {
+namespace {
+
+const auto desc = R"(
+Schwarz Factors
+---------------
+
+Computes Q_ab = max sqrt|(ij|ij)|, i in shell a and j in shell b, for every
+pair of shells with libint2 and returns them as an n_shells by n_shells
+tensor. Since |(ij|kl)| <= Q_ab Q_cd, Q bounds every shell quartet.
+
+Q only depends on the basis set and this module is memoized, so the diagonal
+quartets are computed once per basis set and then shared by every screened
+J/K build which uses it.
+)";
+
+} // namespace
+
+using pt = SchwarzFactors;
+
+MODULE_CTOR(SchwarzFactorsBuilder) {
+    description(desc);
+    satisfies_property_type<pt>();
+}
+
+MODULE_RUN(SchwarzFactorsBuilder) {
+    const auto& [aos] = pt::unwrap_inputs(inputs);
+
+    utilities::initialize_libint();
+    auto basis          = utilities::make_libint_basis(aos.ao_basis_set());
+    const auto n_shells = basis.size();
+
+    std::vector<double> Q(n_shells * n_shells, 0.0);
+    if(n_shells > 0) {
+        libint2::Engine engine(libint2::Operator::coulomb, basis.max_nprim(),
+                               basis.max_l(), 0);
+        const auto& buf = engine.results();
+        for(std::size_t a = 0; a < n_shells; ++a) {
+            const auto na = basis[a].size();
+            for(std::size_t b = 0; b <= a; ++b) {
+                const auto nb = basis[b].size();
+                engine.compute(basis[a], basis[b], basis[a], basis[b]);
+                if(buf[0] == nullptr) continue;
+                double q = 0.0;
+                for(std::size_t i = 0; i < na; ++i)
+                    for(std::size_t j = 0; j < nb; ++j) {
+                        const auto ij = i * nb + j;
+                        q = std::max(q, std::fabs(buf[0][ij * na * nb + ij]));
+                    }
+                Q[a * n_shells + b] = Q[b * n_shells + a] = std::sqrt(q);
+            }
+        }
+    }
+
+    using tensorwrapper::utilities::make_tensor;
+    auto rv = results();
+    return pt::wrap_results(rv, make_tensor({n_shells, n_shells}, Q));
+}
+
+} // namespace scf::jk
+#endif
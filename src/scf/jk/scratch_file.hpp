@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+namespace scf::jk::scratch {
+
+/** @brief Creates an anonymous scratch file in @p dir.
+ *
+ *  The file is unlinked right away, so it disappears as soon as the returned
+ *  descriptor (and any mapping of it) is closed.
+ *
+ *  @throw std::runtime_error if the file can't be created.
+ */
+inline int open_file(const std::filesystem::path& dir,
+                     const std::string& prefix) {
+    auto name = (dir / (prefix + "_XXXXXX")).string();
+    std::vector<char> path(name.begin(), name.end());
+    path.push_back('\0');
+    const int fd = ::mkstemp(path.data());
+    if(fd < 0) throw std::runtime_error("Couldn't create " + name);
+    ::unlink(path.data());
+    return fd;
+}
+
+/// Writes all @p n_bytes of @p bytes to @p fd or throws std::runtime_error
+inline void write_all(int fd, const void* bytes, std::size_t n_bytes) {
+    const auto* pbytes  = static_cast<const char*>(bytes);
+    std::size_t written = 0;
+    while(written < n_bytes) {
+        auto rv = ::write(fd, pbytes + written, n_bytes - written);
+        if(rv <= 0) throw std::runtime_error("Couldn't write scratch file");
+        written += static_cast<std::size_t>(rv);
+    }
+}
+
+/** @brief Maps the first @p n_bytes of @p fd read-only.
+ *
+ *  @throw std::runtime_error if the mapping fails.
+ */
+inline const void* map_read_only(int fd, std::size_t n_bytes) {
+    void* pmap = ::mmap(nullptr, n_bytes, PROT_READ, MAP_SHARED, fd, 0);
+    if(pmap == MAP_FAILED)
+        throw std::runtime_error("Couldn't map scratch file");
+    return pmap;
+}
+
+/// Hints that a mapping will be read front to back
+inline void advise_sequential(const void* pmap, std::size_t n_bytes) noexcept {
+    ::madvise(const_cast<void*>(pmap), n_bytes, MADV_SEQUENTIAL);
+}
+
+/// Releases a mapping made by map_read_only
+inline void unmap(const void* pmap, std::size_t n_bytes) noexcept {
+    ::munmap(const_cast<void*>(pmap), n_bytes);
+}
+
+} // namespace scf::jk::scratch
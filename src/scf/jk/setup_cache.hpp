@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "../guess/atomic_density_cache.hpp"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <simde/simde.hpp>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace scf::jk {
+
+/** @brief Hash of an AO basis set, centers included.
+ *
+ *  Combines guess::atomic_basis_hash() of every center with its
+ *  coordinates. The cost is linear in the number of primitives, so it can be
+ *  evaluated on every call in place of copying and comparing the basis set.
+ */
+inline std::uint64_t basis_fingerprint(const simde::type::aos& aos) {
+    const auto& bs     = aos.ao_basis_set();
+    std::uint64_t seed = 0xcbf29ce484222325ULL;
+    auto hash_word     = [&seed](std::uint64_t x) {
+        for(std::size_t b = 0; b < sizeof(x); ++b) {
+            seed ^= (x >> (8 * b)) & 0xffULL;
+            seed *= 0x100000001b3ULL;
+        }
+    };
+    auto hash_double = [&](double x) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(x));
+        hash_word(bits);
+    };
+
+    hash_word(bs.size());
+    for(std::size_t c = 0; c < bs.size(); ++c) {
+        const auto& center = bs[c].center();
+        hash_double(center.x());
+        hash_double(center.y());
+        hash_double(center.z());
+        hash_word(guess::atomic_basis_hash(bs[c]));
+    }
+    return seed;
+}
+
+/** @brief What a cached setup was built from.
+ *
+ *  Only holds cheap identities. The basis set enters through
+ *  basis_fingerprint() and the integral submodule (if any) through its
+ *  address: a module is locked once it has run and changing an input of a
+ *  locked module makes a new one, so the address identifies the module's
+ *  configuration.
+ */
+struct SetupKey {
+    /// basis_fingerprint() of the AO basis set
+    std::uint64_t aos = 0;
+
+    /// The submodule the setup was computed with, if any
+    const pluginplay::Module* module = nullptr;
+
+    /// Floating-point type of the setup
+    std::type_index type = typeid(void);
+
+    /// Thresholds, sizes, and other numeric inputs
+    std::vector<double> parameters;
+
+    /// Where the setup is stored, if not in memory
+    std::string location;
+
+    bool operator==(const SetupKey&) const = default;
+};
+
+/** @brief The most recent setup of a module that is not a tensor.
+ *
+ *  Precomputed state such as packed integrals, Cholesky vectors, or a CFMM
+ *  tree can't be the memoized result of a submodule, so modules keep the
+ *  last one they built in a (static) instance of this class instead.
+ *  Holding a single entry bounds the memory to one setup per module.
+ */
+class SetupCache {
+public:
+    /** @brief Returns the setup for @p key, building it on a miss.
+     *
+     *  @p make is called with no arguments and must return a
+     *  std::shared_ptr<T>. The returned setup stays alive after it is
+     *  replaced, but setups which are modified while in use must be used
+     *  under lock().
+     */
+    template<typename T, typename FxnType>
+    std::shared_ptr<T> get(const SetupKey& key, FxnType&& make) {
+        std::lock_guard lock(m_mutex_);
+        if(m_key_ != key) {
+            m_setup_.reset();
+            m_key_.reset();
+            m_setup_ = make();
+            m_key_   = key;
+        }
+        return std::static_pointer_cast<T>(m_setup_);
+    }
+
+    /// Serializes users of setups which are modified after they are built
+    std::unique_lock<std::mutex> lock() {
+        return std::unique_lock<std::mutex>(m_use_mutex_);
+    }
+
+private:
+    std::mutex m_mutex_;
+    std::mutex m_use_mutex_;
+    std::optional<SetupKey> m_key_;
+    std::shared_ptr<void> m_setup_;
+};
+
+} // namespace scf::jk
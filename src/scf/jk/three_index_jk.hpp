@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <Eigen/Dense>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace scf::jk {
+
+/** @brief J and K from a three-index factorization of the ERIs.
+ *
+ *  Both density fitting and Cholesky-decomposed ERIs approximate
+ *  (mn|ls) ~ sum_Q B_Qmn B_Qls. Given the row-major n_vec by n by n factor B
+ *  these functions build J and K for the row-major n by n density P with
+ *  dense matrix products only.
+ */
+template<typename FloatType>
+class ThreeIndexJK {
+public:
+    using matrix_type = Eigen::Matrix<FloatType, Eigen::Dynamic,
+                                      Eigen::Dynamic, Eigen::RowMajor>;
+    using vector_type = Eigen::Matrix<FloatType, Eigen::Dynamic, 1>;
+
+    ThreeIndexJK(const FloatType* B, std::size_t n_vec, std::size_t n) :
+      m_pB_(B), m_n_vec_(n_vec), m_n_(n) {}
+
+    /// d_Q = sum_ls B_Qls P_ls, J_mn = sum_Q B_Qmn d_Q
+    std::vector<FloatType> coulomb(const FloatType* P) const {
+        const auto n2 = static_cast<Eigen::Index>(m_n_ * m_n_);
+        Eigen::Map<const matrix_type> B_map(m_pB_, m_n_vec_, n2);
+        Eigen::Map<const vector_type> P_vec(P, n2);
+
+        vector_type d = B_map * P_vec;
+        std::vector<FloatType> J(n2);
+        Eigen::Map<vector_type>(J.data(), n2) = B_map.transpose() * d;
+        return J;
+    }
+
+    /** @brief K = sum_Q (B^Q X) S (B^Q X)^T where P = X S X^T.
+     *
+     *  See factor_density() for how X and S are chosen; for an idempotent
+     *  density X spans the occupied orbitals. With W the n by (n_vec r)
+     *  matrix whose Q-th block of columns is B^Q X, K = W S W^T is a single
+     *  matrix product.
+     */
+    std::vector<FloatType> exchange(const FloatType* P, double thresh) const {
+        const auto n     = static_cast<Eigen::Index>(m_n_);
+        const auto n_vec = static_cast<Eigen::Index>(m_n_vec_);
+
+        // Step 1: P = X S X^T
+        matrix_type X;
+        vector_type S;
+        factor_density(P, thresh, X, S);
+        const auto r = X.cols();
+
+        // Step 2: T^Q = B^Q X for all Q at once, B viewed as (Q m) by n
+        Eigen::Map<const matrix_type> B_map(m_pB_, n_vec * n, n);
+        matrix_type T = B_map * X;
+
+        // Step 3: Gather W = [T^0 T^1 ...] and form K = W S W^T
+        matrix_type W(n, n_vec * r);
+        for(Eigen::Index Q = 0; Q < n_vec; ++Q)
+            W.middleCols(Q * r, r) = T.middleRows(Q * n, n);
+        matrix_type K(n, n);
+        if((S.array() > FloatType(0.0)).all()) {
+            K.noalias() = W * W.transpose();
+        } else {
+            vector_type S_W = S.replicate(n_vec, 1);
+            K.noalias()     = W * S_W.asDiagonal() * W.transpose();
+        }
+        return std::vector<FloatType>(K.data(), K.data() + n * n);
+    }
+
+    /** @brief Factors the symmetric @p P as X S X^T, S diagonal with entries
+     *         of +-1.
+     *
+     *  SCF densities are positive semidefinite, so P is first factored by a
+     *  pivoted Cholesky decomposition, which stops once the largest remaining
+     *  diagonal element is below @p thresh times the largest diagonal element
+     *  of P. This costs O(n^2 r) for rank r (e.g., the number of occupied
+     *  orbitals), instead of the O(n^3) of an eigensolve. If the factors do
+     *  not reproduce P to that tolerance (P is indefinite, e.g., a density
+     *  difference), P is diagonalized instead: the columns of X are the
+     *  eigenvectors scaled by the square roots of the eigenvalue magnitudes,
+     *  S holds the eigenvalue signs, and eigenvalues smaller than @p thresh
+     *  times the largest magnitude are dropped.
+     */
+    void factor_density(const FloatType* P, double thresh, matrix_type& X,
+                        vector_type& S) const {
+        const auto n = static_cast<Eigen::Index>(m_n_);
+        Eigen::Map<const matrix_type> P_map(P, n, n);
+
+        // Pivoted Cholesky; column k of L is the k-th Cholesky vector
+        vector_type d         = P_map.diagonal();
+        const FloatType d_max = n > 0 ? d.maxCoeff() : FloatType(0.0);
+        const FloatType tol   = FloatType(thresh) * d_max;
+        matrix_type L(n, n);
+        Eigen::Index r = 0;
+        for(; r < n; ++r) {
+            Eigen::Index p;
+            const FloatType d_p = d.maxCoeff(&p);
+            if(d_p <= tol) break;
+            vector_type l = P_map.col(p);
+            if(r > 0) l.noalias() -= L.leftCols(r) * L.row(p).transpose();
+            L.col(r) = l / std::sqrt(d_p);
+            d -= L.col(r).cwiseAbs2();
+            d(p) = FloatType(0.0);
+        }
+
+        // Accept the factors if they reproduce P (for a semidefinite P the
+        // remaining elements are bounded by the remaining diagonal)
+        matrix_type R = P_map;
+        R.noalias() -= L.leftCols(r) * L.leftCols(r).transpose();
+        const auto eps = std::numeric_limits<FloatType>::epsilon();
+        if(n == 0 || R.cwiseAbs().maxCoeff() <= tol + eps * n * d_max) {
+            X = L.leftCols(r);
+            S = vector_type::Ones(r);
+            return;
+        }
+
+        Eigen::SelfAdjointEigenSolver<matrix_type> eigen(P_map);
+        const auto& w         = eigen.eigenvalues();
+        const auto& U         = eigen.eigenvectors();
+        const FloatType w_max = w.cwiseAbs().maxCoeff();
+
+        std::vector<Eigen::Index> kept;
+        for(Eigen::Index i = 0; i < w.size(); ++i)
+            if(std::fabs(w(i)) > thresh * w_max) kept.push_back(i);
+
+        const auto n_kept = static_cast<Eigen::Index>(kept.size());
+        X.resize(n, n_kept);
+        S.resize(n_kept);
+        for(Eigen::Index k = 0; k < n_kept; ++k) {
+            const auto i = kept[k];
+            X.col(k)     = U.col(i) * std::sqrt(std::fabs(w(i)));
+            S(k)         = w(i) < 0 ? FloatType(-1.0) : FloatType(1.0);
+        }
+    }
+
+private:
+    const FloatType* m_pB_;
+    std::size_t m_n_vec_;
+    std::size_t m_n_;
+};
+
+} // namespace scf::jk
@@ -14,45 +14,137 @@
  * limitations under the License.
  */
 
+#include "../utilities/block_sparse_matrix.hpp"
+#include "../utilities/parallel_for.hpp"
 #include "matrix_builder.hpp"
+#include <algorithm>
+#include <cmath>
 #include <unsupported/Eigen/CXX11/Tensor>
 
 namespace scf::matrix_builder {
 namespace {
 
 const auto desc = R"(
+Density Matrix Builder
+----------------------
+
+Builds P = C W C^T for the orbitals whose weight magnitude is at least
+"cutoff". The participating columns of C are gathered (they need not be a
+contiguous slice) and scaled by sqrt(|w|), so P is a sum of symmetric
+rank-k updates. Only the lower triangle is computed, in row blocks which are
+distributed over threads, and it is mirrored into the upper triangle while
+writing directly into the output buffer. Uncertain float types are processed
+on a single thread.
+
+If "block sparse threshold" is positive, P is tiled by shell blocks and
+blocks whose Frobenius norm falls below the threshold are set to exactly
+zero, so that block-sparse consumers of P can skip them.
 )";
 
+/// Number of rows in one block of the triangular update
+constexpr std::size_t row_block_size = 64;
+
 struct Kernel {
-    Kernel(std::size_t n_aos, std::size_t n_occ) :
-      m_n_aos(n_aos), m_n_occ(n_occ) {}
-    std::size_t m_n_aos;
-    std::size_t m_n_occ;
+    Kernel(std::size_t n_aos, std::size_t n_mos,
+           const std::vector<std::size_t>& participants,
+           const std::vector<double>& weights,
+           const tensorwrapper::buffer::Contiguous& c,
+           const utilities::block_offsets& offsets, double block_thresh) :
+      m_n_aos(n_aos),
+      m_n_mos(n_mos),
+      m_participants(participants),
+      m_weights(weights),
+      m_c(c),
+      m_offsets(offsets),
+      m_block_thresh(block_thresh) {}
 
+    std::size_t m_n_aos;
+    std::size_t m_n_mos;
+    const std::vector<std::size_t>& m_participants;
+    const std::vector<double>& m_weights;
+    const tensorwrapper::buffer::Contiguous& m_c;
+    const utilities::block_offsets& m_offsets;
+    double m_block_thresh;
+
+    // Dispatches on the (writable) output buffer, which shares C's type
     template<typename FloatType>
-    auto operator()(const std::span<FloatType>& c) {
-        constexpr auto rmajor = Eigen::RowMajor;
-        constexpr auto edynam = Eigen::Dynamic;
-        using clean_type      = std::decay_t<FloatType>;
-        using tensor_type = Eigen::Matrix<clean_type, edynam, edynam, rmajor>;
-        using const_map_type = Eigen::Map<const tensor_type>;
-
-        tensorwrapper::shape::Smooth p_shape{m_n_aos, m_n_aos};
-        auto pp_buffer =
-          tensorwrapper::buffer::make_contiguous<clean_type>(p_shape);
-
-        // Step 2: Grab the orbitals in the ensemble
-        const_map_type c_eigen(c.data(), m_n_aos, m_n_aos);
-        auto slice = c_eigen.block(0, 0, m_n_aos, m_n_occ);
-
-        // Step 3: CC_dagger
-        tensor_type p_eigen = slice * slice.transpose();
-        for(std::size_t i = 0; i < m_n_aos; ++i) {
-            for(std::size_t j = 0; j < m_n_aos; ++j) {
-                pp_buffer.set_elem({i, j}, p_eigen(i, j));
+    void operator()(std::span<FloatType> p) {
+        if constexpr(!std::is_const_v<FloatType>) {
+            constexpr auto rmajor = Eigen::RowMajor;
+            constexpr auto edynam = Eigen::Dynamic;
+            using clean_type      = std::decay_t<FloatType>;
+            using tensor_type =
+              Eigen::Matrix<clean_type, edynam, edynam, rmajor>;
+            using tensorwrapper::buffer::get_raw_data;
+
+            const auto n = m_n_aos;
+            auto c       = get_raw_data<clean_type>(m_c);
+
+            // Step 1: Gather the participating columns, scaled by sqrt(|w|),
+            // split by the sign of their weight
+            std::size_t n_plus = 0;
+            for(auto w : m_weights) n_plus += (w > 0.0);
+            const auto n_minus = m_weights.size() - n_plus;
+            tensor_type c_plus(n, n_plus);
+            tensor_type c_minus(n, n_minus);
+            for(std::size_t k = 0, k_plus = 0, k_minus = 0;
+                k < m_participants.size(); ++k) {
+                const auto w = m_weights[k];
+                const clean_type scale(std::sqrt(std::fabs(w)));
+                auto& dst      = w > 0.0 ? c_plus : c_minus;
+                const auto col = w > 0.0 ? k_plus++ : k_minus++;
+                for(std::size_t mu = 0; mu < n; ++mu) {
+                    dst(mu, col) = c[mu * m_n_mos + m_participants[k]] * scale;
+                }
+            }
+
+            // Step 2: Lower triangle of rows [r0, r1), mirrored to the upper
+            // triangle. Each unordered pair (i, j) is owned by the block
+            // holding row max(i, j), so blocks write disjoint elements.
+            auto row_block = [&](std::size_t r0, std::size_t r1) {
+                const auto m = r1 - r0;
+                tensor_type p_block(m, r1);
+                p_block.setZero();
+                if(n_plus) {
+                    p_block += c_plus.middleRows(r0, m) *
+                               c_plus.topRows(r1).transpose();
+                }
+                if(n_minus) {
+                    p_block -= c_minus.middleRows(r0, m) *
+                               c_minus.topRows(r1).transpose();
+                }
+                for(std::size_t i = r0; i < r1; ++i) {
+                    for(std::size_t j = 0; j <= i; ++j) {
+                        p[i * n + j] = p_block(i - r0, j);
+                        p[j * n + i] = p_block(i - r0, j);
+                    }
+                }
+            };
+
+            // Pair block b with block n_blocks - 1 - b so every work item
+            // covers roughly the same share of the triangle
+            const auto n_blocks = (n + row_block_size - 1) / row_block_size;
+            auto block          = [&](std::size_t b) {
+                const auto r0 = b * row_block_size;
+                row_block(r0, std::min(n, r0 + row_block_size));
+            };
+            auto block_pairs = [&](std::size_t begin, std::size_t end) {
+                for(std::size_t t = begin; t < end; ++t) {
+                    block(t);
+                    if(n_blocks - 1 - t != t) block(n_blocks - 1 - t);
+                }
+            };
+            const bool is_uq = tensorwrapper::types::is_uq_type_v<clean_type>;
+            utilities::parallel_for((n_blocks + 1) / 2, block_pairs,
+                                    is_uq ? 1 : 0);
+
+            // Step 3: Drop negligible shell blocks
+            if constexpr(!tensorwrapper::types::is_uq_type_v<clean_type>) {
+                if(m_block_thresh > 0.0)
+                    utilities::screen_blocks(p.data(), m_offsets,
+                                             m_block_thresh);
             }
         }
-        return simde::type::tensor(p_shape, std::move(pp_buffer));
     }
 };
 
@@ -67,6 +159,10 @@ MODULE_CTOR(DensityMatrix) {
       .set_description(
         "The cutoff for considering a state as part of the ensemble.")
       .set_default(1E-16);
+    add_input<double>("block sparse threshold")
+      .set_description("Shell blocks of P with a smaller norm are zeroed "
+                       "(0 keeps every block)")
+      .set_default(0.0);
 }
 
 MODULE_RUN(DensityMatrix) {
@@ -76,6 +172,8 @@ MODULE_RUN(DensityMatrix) {
     // const auto& ket_aos   = braket.ket();
     const auto& op     = braket.op();
     const auto& cutoff = inputs.at("cutoff").value<double>();
+    const auto block_thresh =
+      inputs.at("block sparse threshold").value<double>();
 
     const auto& mos     = op.orbitals();
     const auto& c       = mos.transform();
@@ -85,22 +183,30 @@ MODULE_RUN(DensityMatrix) {
     // Step 1: Figure out which orbitals we need to grab
     using size_type = std::size_t;
     std::vector<size_type> participants;
-    for(size_type i = 0; i < weights.size(); ++i)
-        if(std::fabs(weights[i]) >= cutoff) participants.push_back(i);
-
-    // For now we require that participants == [0, participants.size())
-    for(size_type i = 0; i < participants.size(); ++i)
-        if(participants[i] != i)
-            throw std::runtime_error(
-              "Please shuffle your orbitals so that the ensemble is a "
-              "contiguous slice of the orbitals.");
+    std::vector<double> participant_weights;
+    for(size_type i = 0; i < weights.size(); ++i) {
+        const auto w = static_cast<double>(weights[i]);
+        if(std::fabs(w) < cutoff) continue;
+        participants.push_back(i);
+        participant_weights.push_back(w);
+    }
 
     // TODO: The need to dispatch like this goes away when TW supports slicing
+    using tensorwrapper::buffer::make_contiguous;
     using tensorwrapper::buffer::visit_contiguous_buffer;
-    Kernel k(n_aos, participants.size());
-    const auto& c_buffer = tensorwrapper::buffer::make_contiguous(c.buffer());
-    auto p               = visit_contiguous_buffer(k, c_buffer);
-    auto rv              = results();
+    const auto& c_buffer = make_contiguous(c.buffer());
+    auto n_mos           = c_buffer.shape().extent(1);
+    tensorwrapper::shape::Smooth p_shape{n_aos, n_aos};
+    auto p_buffer = make_contiguous(c.buffer(), p_shape);
+    utilities::block_offsets offsets;
+    if(block_thresh > 0.0)
+        offsets = utilities::shell_offsets(braket.bra().ao_basis_set());
+    Kernel k(n_aos, n_mos, participants, participant_weights, c_buffer,
+             offsets, block_thresh);
+    visit_contiguous_buffer(k, p_buffer);
+
+    simde::type::tensor p(p_shape, std::move(p_buffer));
+    auto rv = results();
     return pt::wrap_results(rv, p);
 }
 
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <simde/simde.hpp>
+
+namespace scf::matrix_builder {
+
+/** @brief Maps a many-electron operator to its one-electron AO matrix.
+ *
+ *  For T_e, V_en, J_e, and K_e the corresponding one-electron operator is
+ *  evaluated in the bra's AO basis set with the "Two center evaluator"
+ *  submodule. The matrix is left in m_pt and m_ran is set. Whether other
+ *  operators throw or are ignored (m_ran stays false) is controlled by the
+ *  constructor's @p throw_if_unhandled.
+ */
+template<typename WFType>
+class DeterminantDispatcher : public chemist::qm_operator::OperatorVisitor {
+public:
+    using T_e_type  = simde::type::T_e_type;
+    using V_en_type = simde::type::V_en_type;
+    using J_e_type  = simde::type::J_e_type;
+    using K_e_type  = simde::type::K_e_type;
+
+    using ao_pt         = simde::aos_op_base_aos;
+    using ao_type       = simde::type::aos;
+    using op_type       = simde::type::op_base_type;
+    using braket_base   = simde::type::braket<ao_type, op_type, ao_type>;
+    using submodule_map = pluginplay::type::submodule_map;
+
+    DeterminantDispatcher(const WFType& bra, const WFType& ket,
+                          submodule_map& submods,
+                          bool throw_if_unhandled = true) :
+      chemist::qm_operator::OperatorVisitor(throw_if_unhandled),
+      m_pbra_(&bra),
+      m_pket_(&ket),
+      m_psubmods_(&submods) {}
+
+    void run(const T_e_type& T_e) {
+        simde::type::electron e;
+        simde::type::t_e_type t_e(e);
+        run_(t_e);
+    }
+
+    void run(const V_en_type& V_en) {
+        simde::type::electron e;
+        simde::type::v_en_type v_en(e, V_en.get_rhs_particle().as_nuclei());
+        run_(v_en);
+    }
+
+    void run(const J_e_type& J_e) {
+        simde::type::electron e;
+        simde::type::j_e_type j_e(e, J_e.get_rhs_particle());
+        run_(j_e);
+    }
+
+    void run(const K_e_type& K_e) {
+        simde::type::electron e;
+        simde::type::k_e_type k_e(e, K_e.get_rhs_particle());
+        run_(k_e);
+    }
+
+    template<typename OpType>
+    void run_(const OpType& o) {
+        const auto& aos = m_pbra_->orbitals().from_space();
+        braket_base o_mn(aos, o, aos);
+        auto& mod = m_psubmods_->at("Two center evaluator");
+        m_pt      = mod.run_as<ao_pt>(o_mn);
+        m_ran     = true;
+    }
+
+    bool m_ran = false;
+    simde::type::tensor m_pt;
+
+private:
+    const WFType* m_pbra_;
+    const WFType* m_pket_;
+    submodule_map* m_psubmods_;
+};
+
+} // namespace scf::matrix_builder
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "determinant_dispatcher.hpp"
 #include "matrix_builder.hpp"
 
 namespace scf::matrix_builder {
@@ -36,61 +37,6 @@ using ao_type     = simde::type::aos;
 using op_type     = simde::type::op_base_type;
 using braket_base = simde::type::braket<ao_type, op_type, ao_type>;
 
-template<typename WFType>
-class DeterminantDispatcher : public chemist::qm_operator::OperatorVisitor {
-public:
-    using T_e_type  = simde::type::T_e_type;
-    using V_en_type = simde::type::V_en_type;
-    using J_e_type  = simde::type::J_e_type;
-    using K_e_type  = simde::type::K_e_type;
-
-    using submodule_map = pluginplay::type::submodule_map;
-
-    DeterminantDispatcher(const WFType& bra, const WFType& ket,
-                          submodule_map& submods) :
-      m_pbra_(&bra), m_pket_(&ket), m_psubmods_(&submods) {}
-
-    void run(const T_e_type& T_e) {
-        simde::type::electron e;
-        simde::type::t_e_type t_e(e);
-        run_(t_e);
-    }
-
-    void run(const V_en_type& V_en) {
-        simde::type::electron e;
-        simde::type::v_en_type v_en(e, V_en.get_rhs_particle().as_nuclei());
-        run_(v_en);
-    }
-
-    void run(const J_e_type& J_e) {
-        simde::type::electron e;
-        simde::type::j_e_type j_e(e, J_e.get_rhs_particle());
-        run_(j_e);
-    }
-
-    void run(const K_e_type& K_e) {
-        simde::type::electron e;
-        simde::type::k_e_type k_e(e, K_e.get_rhs_particle());
-        run_(k_e);
-    }
-
-    template<typename OpType>
-    void run_(const OpType& o) {
-        const auto& aos = m_pbra_->orbitals().from_space();
-        braket_base o_mn(aos, o, aos);
-        auto& mod     = m_psubmods_->at("Two center evaluator");
-        const auto& t = mod.run_as<ao_pt>(o_mn);
-        m_pt          = t;
-    }
-
-    simde::type::tensor m_pt;
-
-private:
-    const WFType* m_pbra_;
-    const WFType* m_pket_;
-    submodule_map* m_psubmods_;
-};
-
 } // namespace
 
 MODULE_CTOR(DeterminantDriver) {
@@ -14,13 +14,32 @@
  * limitations under the License.
  */
 
+#include "determinant_dispatcher.hpp"
+#include "hybrid_exchange.hpp"
 #include "matrix_builder.hpp"
+#include "matrix_kernels.hpp"
 
 namespace scf::matrix_builder {
 
 namespace {
 
 const auto desc = R"(
+Electronic Energy
+-----------------
+
+Evaluates <Psi|H|Psi> = sum_i c_i <Psi|O_i|Psi> for a determinant Psi.
+
+The AO density matrix P is built once (with the "Two center evaluator") and
+the one-electron matrices of all T, V_en, J, and K terms are accumulated in
+place into W = sum_i c_i O_i. The determinant part of the energy is then the
+single contraction Tr[P W], evaluated over one triangle since both matrices
+are symmetric. XC terms are evaluated by the "XC Energy" submodule and any
+other operator by the "determinant driver" submodule.
+
+If H has an XC term and an exchange term (a hybrid functional) and
+"seminumerical hybrid exchange" is true (the default), the exchange matrix
+comes from the "Hybrid exchange matrix" submodule, as in the Fock matrix
+builder, so the energy and the Fock matrix use the same exchange.
 )";
 
 }
@@ -29,6 +48,8 @@ using pluginplay::type::submodule_map;
 using simde::type::electronic_hamiltonian;
 
 using XC_e_t = simde::type::XC_e_type;
+using ao_pt  = simde::aos_op_base_aos;
+using k_pt   = simde::aos_k_e_aos;
 
 template<typename WFType>
 using pt = simde::eval_braket<WFType, electronic_hamiltonian, WFType>;
@@ -39,6 +60,9 @@ using xc_pt = simde::eval_braket<WFType, XC_e_t, WFType>;
 template<typename WFType>
 using det_pt = simde::eval_braket<WFType, simde::type::op_base_type, WFType>;
 
+template<typename WFType>
+using density_op_t = simde::type::rho_e<typename WFType::orbital_space_type>;
+
 template<typename WFType>
 class EnergyDispatcher : public chemist::qm_operator::OperatorVisitor {
 public:
@@ -70,36 +94,92 @@ MODULE_CTOR(ElectronicEnergy) {
     satisfies_property_type<pt<wf_type>>();
     add_submodule<det_pt<wf_type>>("determinant driver");
     add_submodule<xc_pt<wf_type>>("XC Energy");
+    add_submodule<ao_pt>("Two center evaluator");
+    add_submodule<k_pt>(hybrid_k_submod);
+
+    add_input<bool>(hybrid_k_key)
+      .set_default(true)
+      .set_description("Build the exchange term of hybrid functionals with "
+                       "the Hybrid exchange matrix submodule?");
 }
 
 MODULE_RUN(ElectronicEnergy) {
     using wf_type       = simde::type::rscf_wf;
+    using tensor_t      = simde::type::tensor;
     const auto&& [H_ij] = pt<wf_type>::unwrap_inputs(inputs);
     const auto& bra     = H_ij.bra();
     const auto& H       = H_ij.op();
     const auto& ket     = H_ij.ket();
 
-    simde::type::tensor e;
-    auto& det_mod = submods.at("determinant driver");
-    EnergyDispatcher<wf_type> visitor(&bra, &ket, &submods);
+    auto& det_mod       = submods.at("determinant driver");
+    auto& hybrid_k_mod  = submods.at(hybrid_k_submod);
+    const auto hybrid_k = inputs.at(hybrid_k_key).value<bool>() &&
+                          has_xc_term(H);
+
+    // Scalar contributions (XC and operators we can't map to a matrix)
+    tensor_t e;
+    bool have_e   = false;
+    auto add_to_e = [&](const tensor_t& o, double ci) {
+        tensor_t temp;
+        temp("") = o("") * ci;
+        if(!have_e) {
+            e      = temp;
+            have_e = true;
+        } else {
+            e("") = e("") + temp("");
+        }
+    };
 
+    // W = sum_i c_i O_i over the determinant terms
+    MatrixAccumulator W;
     auto n_ops = H.size();
     for(decltype(n_ops) i = 0; i < n_ops; ++i) {
-        const auto& ci  = H.coefficient(i);
+        const auto ci   = static_cast<double>(H.coefficient(i));
         const auto& O_i = H.get_operator(i);
 
-        O_i.visit(visitor);
-        simde::type::tensor temp;
-        if(visitor.m_ran) {
-            temp("") = visitor.m_o("") * ci;
+        EnergyDispatcher<wf_type> xc_visitor(&bra, &ket, &submods);
+        O_i.visit(xc_visitor);
+        if(xc_visitor.m_ran) {
+            add_to_e(xc_visitor.m_o, ci);
+            continue;
+        }
+
+        if(hybrid_k) {
+            HybridTermVisitor k_visitor;
+            O_i.visit(k_visitor);
+            if(k_visitor.m_k_e) {
+                const auto& aos = bra.orbitals().from_space();
+                chemist::braket::BraKet k_mn(aos, *k_visitor.m_k_e, aos);
+                W.add(ci, hybrid_k_mod.run_as<k_pt>(k_mn));
+                continue;
+            }
+        }
+
+        DeterminantDispatcher<wf_type> det_visitor(bra, ket, submods, false);
+        O_i.visit(det_visitor);
+        if(det_visitor.m_ran) {
+            W.add(ci, det_visitor.m_pt);
         } else {
             chemist::braket::BraKet O_ij(bra, O_i, ket);
-            const auto& o = det_mod.run_as<det_pt<wf_type>>(O_ij);
-            temp("")      = o("") * ci;
+            add_to_e(det_mod.run_as<det_pt<wf_type>>(O_ij), ci);
+        }
+    }
+
+    if(!W.empty()) {
+        // Build P once and contract it with all of the terms at once
+        const auto& mos = bra.orbitals();
+        const auto& aos = mos.from_space();
+        density_op_t<wf_type> rho_hat(mos, bra.occupations());
+        chemist::braket::BraKet p_mn(aos, rho_hat, aos);
+        auto& ao_mod  = submods.at("Two center evaluator");
+        const auto& P = ao_mod.run_as<ao_pt>(p_mn);
+
+        auto e_det = symmetric_trace_product(P, W.release());
+        if(!have_e) {
+            e = std::move(e_det);
+        } else {
+            e("") = e("") + e_det("");
         }
-        if(i == 0)
-            e = temp;
-        else { e("") = e("") + temp(""); }
     }
 
     auto rv = results();
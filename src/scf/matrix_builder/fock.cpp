@@ -14,56 +14,103 @@
  * limitations under the License.
  */
 
+#include "hybrid_exchange.hpp"
 #include "matrix_builder.hpp"
+#include "matrix_kernels.hpp"
+#include <future>
+#include <vector>
 
 namespace scf::matrix_builder {
 namespace {
 
 const auto desc = R"(
+Fock Matrix Builder
+-------------------
+
+Builds the AO matrix of an operator that is a linear combination of terms,
+F = sum_i c_i O_i (e.g., T + V_en + 2J - K + V_xc), by evaluating each term
+with the "Two center evaluator" submodule. Each term is scaled and added in
+place into a single preallocated F buffer as it becomes available, so no
+temporaries are made for the scaled terms or the partial sums.
+
+If the operator has an XC term, i.e., it is the Kohn-Sham operator of a hybrid
+functional, and "seminumerical hybrid exchange" is true (the default), its
+exchange term is instead built by the "Hybrid exchange matrix" submodule (by
+default sn-LinK, on the XC grid).
+
+If "concurrent terms" is true, the terms are evaluated concurrently (one task
+per term); they are still accumulated in order so the result does not depend
+on the scheduling. This requires the evaluator (and its submodules) to be safe
+to run from several threads at once, hence it is off by default.
 )";
 
-}
+constexpr const char* concurrent_key = "concurrent terms";
+
+} // namespace
 
 using pt    = simde::aos_f_e_aos;
 using ao_pt = simde::aos_op_base_aos;
+using k_pt  = simde::aos_k_e_aos;
 
 MODULE_CTOR(Fock) {
     description(desc);
     satisfies_property_type<pt>();
     add_submodule<ao_pt>("Two center evaluator");
+    add_submodule<k_pt>(hybrid_k_submod);
+
+    add_input<bool>(concurrent_key)
+      .set_default(false)
+      .set_description("Evaluate the operator's terms concurrently?");
+    add_input<bool>(hybrid_k_key)
+      .set_default(true)
+      .set_description("Build the exchange term of hybrid functionals with "
+                       "the Hybrid exchange matrix submodule?");
 }
 
 MODULE_RUN(Fock) {
+    using tensor_t        = simde::type::tensor;
     const auto&& [braket] = pt::unwrap_inputs(inputs);
     const auto& bra_aos   = braket.bra();
     const auto& f         = braket.op();
     const auto& ket_aos   = braket.ket();
     auto& ao_dispatcher   = submods.at("Two center evaluator");
+    const auto concurrent = inputs.at(concurrent_key).value<bool>();
+    auto& hybrid_k_mod    = submods.at(hybrid_k_submod);
+    const auto hybrid_k   = inputs.at(hybrid_k_key).value<bool>() &&
+                          has_xc_term(f);
 
-    simde::type::tensor F;
-    auto n_terms = f.size();
-    if(n_terms > 0) {
-        // Initialize F to zero-th term
-        const auto c0    = f.coefficient(0);
-        const auto& op_0 = f.get_operator(0);
-        chemist::braket::BraKet term0(bra_aos, op_0, ket_aos);
-        F = ao_dispatcher.run_as<ao_pt>(term0);
-
-        F("i,j") = F("i,j") * c0;
-
-        for(decltype(n_terms) i = 1; i < n_terms; ++i) {
-            const auto ci    = f.coefficient(i);
-            const auto& op_i = f.get_operator(i);
-            chemist::braket::BraKet termi(bra_aos, op_i, ket_aos);
-            auto matrix = ao_dispatcher.run_as<ao_pt>(termi);
-
-            matrix("i,j") = matrix("i,j") * ci;
-            F("i,j")      = F("i,j") + matrix("i,j");
+    using size_type         = std::size_t;
+    const size_type n_terms = f.size();
+
+    auto eval_term = [&](size_type i) {
+        const auto& op_i = f.get_operator(i);
+        if(hybrid_k) {
+            HybridTermVisitor visitor;
+            op_i.visit(visitor);
+            if(visitor.m_k_e) {
+                chemist::braket::BraKet k_mn(bra_aos, *visitor.m_k_e, ket_aos);
+                return hybrid_k_mod.run_as<k_pt>(k_mn);
+            }
         }
+        chemist::braket::BraKet termi(bra_aos, op_i, ket_aos);
+        return ao_dispatcher.run_as<ao_pt>(termi);
+    };
+
+    MatrixAccumulator F;
+    if(concurrent && n_terms > 1) {
+        std::vector<std::future<tensor_t>> pending;
+        pending.reserve(n_terms);
+        for(size_type i = 0; i < n_terms; ++i)
+            pending.push_back(std::async(std::launch::async, eval_term, i));
+        for(size_type i = 0; i < n_terms; ++i)
+            F.add(static_cast<double>(f.coefficient(i)), pending[i].get());
+    } else {
+        for(size_type i = 0; i < n_terms; ++i)
+            F.add(static_cast<double>(f.coefficient(i)), eval_term(i));
     }
 
     auto rv = results();
-    return pt::wrap_results(rv, F);
+    return pt::wrap_results(rv, F.release());
 }
 
 } // namespace scf::matrix_builder
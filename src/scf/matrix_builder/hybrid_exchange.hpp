@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <simde/simde.hpp>
+
+namespace scf::matrix_builder {
+
+/// Input which sends the exchange of hybrid functionals to its own submodule
+inline constexpr const char* hybrid_k_key = "seminumerical hybrid exchange";
+
+/// Submodule which builds the exchange matrix of hybrid functionals
+inline constexpr const char* hybrid_k_submod = "Hybrid exchange matrix";
+
+/** @brief Notes whether a term is XC and converts exchange terms.
+ *
+ *  A hybrid Kohn-Sham operator (or Hamiltonian) is one with both an XC term
+ *  and an exchange term. Exchange terms, one- or many-electron, are stored
+ *  as the one-electron exchange operator so that their AO matrix can be
+ *  requested directly. Other terms are ignored.
+ */
+class HybridTermVisitor : public chemist::qm_operator::OperatorVisitor {
+public:
+    HybridTermVisitor() : chemist::qm_operator::OperatorVisitor(false) {}
+
+    void run(const simde::type::xc_e_type&) { m_is_xc = true; }
+
+    void run(const simde::type::XC_e_type&) { m_is_xc = true; }
+
+    void run(const simde::type::k_e_type& k_e) { m_k_e.emplace(k_e); }
+
+    void run(const simde::type::K_e_type& K_e) {
+        simde::type::electron e;
+        m_k_e.emplace(e, K_e.get_rhs_particle());
+    }
+
+    bool m_is_xc = false;
+    std::optional<simde::type::k_e_type> m_k_e;
+};
+
+/// Does any term of the linear combination @p op have an XC part?
+template<typename OpType>
+bool has_xc_term(const OpType& op) {
+    for(std::size_t i = 0; i < op.size(); ++i) {
+        HybridTermVisitor visitor;
+        op.get_operator(i).visit(visitor);
+        if(visitor.m_is_xc) return true;
+    }
+    return false;
+}
+
+} // namespace scf::matrix_builder
@@ -38,8 +38,15 @@ inline void set_defaults(pluginplay::ModuleManager& mm) {
     // mm.change_submod(ao_driver, "Fock matrix", "Fock Matrix Builder");
     mm.change_submod(ao_driver, "Density matrix", "Density matrix builder");
     mm.change_submod(ao_driver, "XC Potential", "GauXC XC Potential");
+#ifdef BUILD_TAMM_SCF
+    mm.change_submod(ao_driver, "Coulomb matrix", "J via JK driver");
+    mm.change_submod(ao_driver, "Exchange matrix", "K via JK driver");
+    mm.change_submod(ao_driver, "Stored JK driver", "Conventional J and K");
+#endif
+    mm.change_submod(ao_driver, "Seminumerical exchange matrix", "snLinK");
 
     mm.change_submod("Fock Matrix Builder", "Two center evaluator", ao_driver);
+    mm.change_submod("Fock matrix builder", "Hybrid exchange matrix", "snLinK");
 
     const auto det_driver = "Determinant driver";
     mm.change_submod(det_driver, "Two center evaluator", ao_driver);
@@ -47,6 +54,8 @@ inline void set_defaults(pluginplay::ModuleManager& mm) {
 
     mm.change_submod("Electronic energy", "determinant driver", det_driver);
     mm.change_submod("Electronic energy", "XC Energy", "GauXC XC Energy");
+    mm.change_submod("Electronic energy", "Two center evaluator", ao_driver);
+    mm.change_submod("Electronic energy", "Hybrid exchange matrix", "snLinK");
 }
 
 } // namespace scf::matrix_builder
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <simde/simde.hpp>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace scf::matrix_builder {
+namespace detail {
+
+/* Computes y = alpha * x (m_overwrite) or y += alpha * x in place on the raw
+ * elements of y. Dispatches on the (writable) buffer y; x must have the same
+ * float type and number of elements.
+ */
+struct AxpyKernel {
+    double m_alpha;
+    const tensorwrapper::buffer::Contiguous& m_x;
+    bool m_overwrite;
+
+    template<typename FloatType>
+    void operator()(std::span<FloatType> y) {
+        // The dispatch instantiates const-qualified spans too; only the
+        // mutable buffer is ever written.
+        if constexpr(!std::is_const_v<FloatType>) {
+            using clean_t = std::decay_t<FloatType>;
+            using tensorwrapper::buffer::get_raw_data;
+            auto x = get_raw_data<clean_t>(m_x);
+            if(x.size() != y.size()) {
+                throw std::runtime_error("AxpyKernel: size mismatch");
+            }
+            const clean_t alpha(m_alpha);
+            if(m_overwrite) {
+                for(std::size_t k = 0; k < y.size(); ++k) y[k] = alpha * x[k];
+            } else {
+                for(std::size_t k = 0; k < y.size(); ++k) y[k] += alpha * x[k];
+            }
+        }
+    }
+};
+
+/* Computes sum_ij A_ij B_ij for symmetric n by n A and B from the lower
+ * triangles of A and B only: the diagonal plus twice the strict lower
+ * triangle. The result is written to element 0 of the output buffer.
+ */
+struct SymmetricDotKernel {
+    std::size_t m_n;
+    const tensorwrapper::buffer::Contiguous& m_a;
+    const tensorwrapper::buffer::Contiguous& m_b;
+
+    template<typename FloatType>
+    void operator()(std::span<FloatType> out) {
+        if constexpr(!std::is_const_v<FloatType>) {
+            using clean_t = std::decay_t<FloatType>;
+            using tensorwrapper::buffer::get_raw_data;
+            auto a = get_raw_data<clean_t>(m_a);
+            auto b = get_raw_data<clean_t>(m_b);
+            clean_t diag(0.0);
+            clean_t off(0.0);
+            for(std::size_t i = 0; i < m_n; ++i) {
+                const auto row = i * m_n;
+                diag += a[row + i] * b[row + i];
+                for(std::size_t j = 0; j < i; ++j)
+                    off += a[row + j] * b[row + j];
+            }
+            out[0] = diag + clean_t(2.0) * off;
+        }
+    }
+};
+
+} // namespace detail
+
+/** @brief Accumulates a linear combination of matrices into one buffer.
+ *
+ *  The first term added determines the shape and float type of the result
+ *  and allocates its buffer; every later term is scaled and added into that
+ *  buffer in place, so no temporaries are created for the scaled terms or the
+ *  partial sums.
+ */
+class MatrixAccumulator {
+public:
+    using tensor_type = simde::type::tensor;
+
+    /** @brief Adds @p coef * @p term to the running sum.
+     *
+     *  @throw std::runtime_error if @p term's shape differs from the shape of
+     *                            the first term.
+     */
+    void add(double coef, const tensor_type& term) {
+        using tensorwrapper::buffer::make_contiguous;
+        using tensorwrapper::buffer::visit_contiguous_buffer;
+        const auto& x    = make_contiguous(term.buffer());
+        const auto& x_sh = x.shape();
+        if(x_sh.rank() != 2) {
+            throw std::runtime_error("MatrixAccumulator: term is not a matrix");
+        }
+        const auto rows  = x_sh.extent(0);
+        const auto cols  = x_sh.extent(1);
+        const bool first = !m_buffer.has_value();
+        if(first) {
+            m_shape = tensorwrapper::shape::Smooth{rows, cols};
+            m_buffer.emplace(make_contiguous(term.buffer(), m_shape));
+        } else if(rows != m_shape.extent(0) || cols != m_shape.extent(1)) {
+            throw std::runtime_error("MatrixAccumulator: shape mismatch");
+        }
+        detail::AxpyKernel kernel{coef, x, first};
+        visit_contiguous_buffer(kernel, *m_buffer);
+    }
+
+    /// True if no terms have been added
+    bool empty() const noexcept { return !m_buffer.has_value(); }
+
+    /// Releases the accumulated sum; the default tensor if empty()
+    tensor_type release() {
+        if(empty()) return tensor_type{};
+        tensor_type rv(m_shape, std::move(*m_buffer));
+        m_buffer.reset();
+        return rv;
+    }
+
+private:
+    tensorwrapper::shape::Smooth m_shape;
+    std::optional<tensorwrapper::buffer::Contiguous> m_buffer;
+};
+
+/** @brief Returns Tr[A B] for symmetric matrices @p A and @p B.
+ *
+ *  Only the lower triangles are read, which halves the work of the full
+ *  contraction. The result is a scalar tensor with the float type of @p A.
+ *
+ *  @throw std::runtime_error if @p A and @p B are not the same square shape.
+ */
+inline simde::type::tensor symmetric_trace_product(
+  const simde::type::tensor& A, const simde::type::tensor& B) {
+    using tensorwrapper::buffer::make_contiguous;
+    using tensorwrapper::buffer::visit_contiguous_buffer;
+    const auto& a = make_contiguous(A.buffer());
+    const auto& b = make_contiguous(B.buffer());
+    if(a.shape().rank() != 2 || b.shape().rank() != 2) {
+        throw std::runtime_error("symmetric_trace_product: not matrices");
+    }
+    const auto n = a.shape().extent(0);
+    if(a.shape().extent(1) != n || b.shape().extent(0) != n ||
+       b.shape().extent(1) != n) {
+        throw std::runtime_error("symmetric_trace_product: shape mismatch");
+    }
+    tensorwrapper::shape::Smooth shape{};
+    auto out = make_contiguous(A.buffer(), shape);
+    detail::SymmetricDotKernel kernel{n, a, b};
+    visit_contiguous_buffer(kernel, out);
+    return simde::type::tensor(shape, std::move(out));
+}
+
+} // namespace scf::matrix_builder
@@ -14,7 +14,12 @@
  * limitations under the License.
  */
 
+#include "../jk/jk_property_types.hpp"
 #include "matrix_builder.hpp"
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 
 namespace scf::matrix_builder {
 
@@ -23,8 +28,52 @@ namespace {
 const auto desc = R"(
 AO Integrals Driver
 -------------------
+
+Evaluates the AO matrix of a one-electron operator. Densities and XC
+potentials are handed to the "Density matrix" and "XC Potential"
+submodules. In builds with libint2 (BUILD_TAMM_SCF) Coulomb and exchange
+operators of (non-UQ) densities go to the "Coulomb matrix" and "Exchange
+matrix" submodules, unless "J and K via JK driver" is set to false. By
+default both go through the memoized "Direct J and K" module, so J and K of
+the same density are built together in one pass over the screened shell
+quartets. Everything else goes to "Fundamental matrices".
+
+Setting "conventional" selects conventional SCF, whatever "J and K via JK
+driver" is: Coulomb and exchange operators then both go to the "Stored JK
+driver" submodule, which by default builds J and K from ERIs that are
+computed once per basis set and stored, instead of direct integrals. J and K
+of the same density share one (memoized) call of that submodule.
+
+Other builds have none of these submodules and inputs; Coulomb and exchange
+operators go to "Fundamental matrices" like everything else.
+
+Setting "seminumerical exchange" sends every exchange operator to the
+"Seminumerical exchange matrix" submodule instead (by default sn-LinK), which
+integrates K on the same molecular grid and load balancer as the XC potential.
+This takes precedence over the two settings above. The Fock matrix builder and
+the electronic energy already send the exchange of hybrid functionals to
+sn-LinK by default, so this is only needed for other operators (e.g., to run
+Hartree-Fock with sn-LinK).
 )";
 
+constexpr const char* jk_key           = "J and K via JK driver";
+constexpr const char* conventional_key = "conventional";
+constexpr const char* sn_k_key         = "seminumerical exchange";
+
+// The JK drivers only handle plain floating-point densities
+struct IsUQ {
+    template<typename FloatType>
+    bool operator()(const std::span<FloatType>&) {
+        return tensorwrapper::types::is_uq_type_v<std::decay_t<FloatType>>;
+    }
+};
+
+bool is_uq(const simde::type::tensor& t) {
+    using tensorwrapper::buffer::make_contiguous;
+    const auto& buffer = make_contiguous(t.buffer());
+    return tensorwrapper::buffer::visit_contiguous_buffer(IsUQ{}, buffer);
+}
+
 }
 
 using pluginplay::type::submodule_map;
@@ -35,6 +84,9 @@ using pt       = simde::aos_op_base_aos;
 using f_e_pt   = simde::aos_f_e_aos;
 using rho_e_pt = simde::aos_rho_e_aos<simde::type::cmos>;
 using xc_e_pt  = simde::aos_xc_e_aos;
+using j_e_pt   = simde::aos_j_e_aos;
+using k_e_pt   = simde::aos_k_e_aos;
+using jk_pt    = scf::jk::JKDriver;
 
 class AODispatcher : public chemist::qm_operator::OperatorVisitor {
 private:
@@ -44,14 +96,20 @@ public:
     using f_e_type     = simde::type::fock;
     using rho_e_type   = simde::type::rho_e<simde::type::cmos>;
     using xc_e_type    = simde::type::xc_e_type;
+    using j_e_type     = simde::type::j_e_type;
+    using k_e_type     = simde::type::k_e_type;
     using submods_type = pluginplay::type::submodule_map;
 
     AODispatcher(const aos& bra, const aos& ket, submodule_map& submods,
-                 tensor& t) :
+                 tensor& t, bool use_jk_driver, bool conventional,
+                 bool seminumerical_k) :
       base_type(false),
       m_pbra_(&bra),
       m_pket_(&ket),
       m_evaluated_(false),
+      m_use_jk_driver_(use_jk_driver),
+      m_conventional_(conventional),
+      m_seminumerical_k_(seminumerical_k),
       m_psubmods_(&submods),
       m_ptensor_(&t) {}
 
@@ -76,12 +134,57 @@ public:
         m_evaluated_   = true;
     }
 
+    void run(const j_e_type& j_e) {
+        if(m_conventional_) {
+            *m_ptensor_  = std::get<0>(run_stored_(j_e));
+            m_evaluated_ = true;
+            return;
+        }
+        if(!use_jk_driver_(j_e)) return;
+        chemist::braket::BraKet input(*m_pbra_, j_e, *m_pket_);
+        const auto key = "Coulomb matrix";
+        *m_ptensor_    = m_psubmods_->at(key).run_as<j_e_pt>(input);
+        m_evaluated_   = true;
+    }
+
+    void run(const k_e_type& k_e) {
+        if(m_conventional_ && !m_seminumerical_k_) {
+            *m_ptensor_  = std::get<1>(run_stored_(k_e));
+            m_evaluated_ = true;
+            return;
+        }
+        if(!use_jk_driver_(k_e) && !m_seminumerical_k_) return;
+        chemist::braket::BraKet input(*m_pbra_, k_e, *m_pket_);
+        const auto key = m_seminumerical_k_ ? "Seminumerical exchange matrix" :
+                                              "Exchange matrix";
+        *m_ptensor_    = m_psubmods_->at(key).run_as<k_e_pt>(input);
+        m_evaluated_   = true;
+    }
+
     bool evaluated() const noexcept { return m_evaluated_; }
 
 private:
+    template<typename OpType>
+    bool use_jk_driver_(const OpType& op) const {
+        return m_use_jk_driver_ && !is_uq(op.get_rhs_particle().value());
+    }
+
+    // J and K of the operator's density from the stored-ERI driver
+    template<typename OpType>
+    auto run_stored_(const OpType& op) {
+        if(*m_pbra_ != *m_pket_)
+            throw std::runtime_error("Expected the same basis set!");
+        const auto& P = op.get_rhs_particle().value();
+        auto& driver  = m_psubmods_->at("Stored JK driver");
+        return driver.run_as<jk_pt>(*m_pbra_, P);
+    }
+
     const aos* m_pbra_;
     const aos* m_pket_;
     bool m_evaluated_ = false;
+    bool m_use_jk_driver_;
+    bool m_conventional_;
+    bool m_seminumerical_k_;
     submodule_map* m_psubmods_;
     tensor* m_ptensor_;
 };
@@ -92,6 +195,23 @@ MODULE_CTOR(SCFIntegralsDriver) {
     add_submodule<pt>("Fundamental matrices");
     add_submodule<rho_e_pt>("Density matrix");
     add_submodule<xc_e_pt>("XC Potential");
+#ifdef BUILD_TAMM_SCF
+    add_submodule<j_e_pt>("Coulomb matrix");
+    add_submodule<k_e_pt>("Exchange matrix");
+    add_submodule<jk_pt>("Stored JK driver");
+#endif
+    add_submodule<k_e_pt>("Seminumerical exchange matrix");
+
+#ifdef BUILD_TAMM_SCF
+    add_input<bool>(jk_key).set_default(true).set_description(
+      "Build J and K with the Coulomb/Exchange matrix submodules?");
+    add_input<bool>(conventional_key)
+      .set_default(false)
+      .set_description("Build J and K from stored instead of direct ERIs?");
+#endif
+    add_input<bool>(sn_k_key).set_default(false).set_description(
+      "Build K on the XC grid with the Seminumerical exchange matrix "
+      "submodule?");
 }
 
 MODULE_RUN(SCFIntegralsDriver) {
@@ -99,9 +219,17 @@ MODULE_RUN(SCFIntegralsDriver) {
     const auto& bra       = braket.bra();
     const auto& op        = braket.op();
     const auto& ket       = braket.ket();
+    const auto sn_k       = inputs.at(sn_k_key).value<bool>();
+#ifdef BUILD_TAMM_SCF
+    const auto use_jk = inputs.at(jk_key).value<bool>();
+    const auto stored = inputs.at(conventional_key).value<bool>();
+#else
+    const bool use_jk = false;
+    const bool stored = false;
+#endif
 
     tensor t;
-    AODispatcher visitor(bra, ket, submods, t);
+    AODispatcher visitor(bra, ket, submods, t, use_jk, stored, sn_k);
     op.visit(visitor);
     if(!visitor.evaluated()) {
         t = submods.at("Fundamental matrices").run_as<pt>(braket);
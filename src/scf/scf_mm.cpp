@@ -18,6 +18,7 @@
 #include "eigen_solver/eigen_solver.hpp"
 #include "fock_operator/fock_operator.hpp"
 #include "guess/guess.hpp"
+#include "jk/jk.hpp"
 #include "matrix_builder/matrix_builder.hpp"
 #include "scf_modules.hpp"
 #include "update/update.hpp"
@@ -31,6 +32,7 @@ void load_modules(pluginplay::ModuleManager& mm) {
     eigen_solver::load_modules(mm);
     fock_operator::load_modules(mm);
     guess::load_modules(mm);
+    jk::load_modules(mm);
     matrix_builder::load_modules(mm);
     update::load_modules(mm);
     xc::load_modules(mm);
@@ -44,6 +46,7 @@ void load_modules(pluginplay::ModuleManager& mm) {
 
     driver::set_defaults(mm);
     guess::set_defaults(mm);
+    jk::set_defaults(mm);
     matrix_builder::set_defaults(mm);
     update::set_defaults(mm);
     xc::set_defaults(mm);
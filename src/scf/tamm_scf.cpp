@@ -19,6 +19,7 @@
 #include "exachem/common/initialize_system_data.hpp"
 #include "exachem/scf/scf_main.hpp"
 #include "scf_modules.hpp"
+#include "utilities/libint_basis.hpp"
 #include <libint2.hpp>
 #include <simde/simde.hpp>
 
@@ -26,65 +27,6 @@ namespace scf {
 
 using energy_pt = simde::AOEnergy;
 
-inline libint2::BasisSet make_libint_basis(
-  const simde::type::ao_basis_set& bs) {
-    /// Typedefs for everything
-    using atom_t          = libint2::Atom;
-    using shell_t         = libint2::Shell;
-    using basis_t         = libint2::BasisSet;
-    using cont_t          = libint2::Shell::Contraction;
-    using svec_d_t        = libint2::svector<double>;
-    using conts_t         = libint2::svector<cont_t>;
-    using centers_t       = std::vector<atom_t>;
-    using atom_bases_t    = std::vector<shell_t>;
-    using element_bases_t = std::vector<atom_bases_t>;
-
-    /// Inputs for BasisSet constructor
-    centers_t centers{};
-    element_bases_t element_bases{};
-
-    /// Atom doesn't have a value ctor, so here's a stand in
-    auto atom_ctor = [](int Z, double x, double y, double z) {
-        atom_t atom{};
-        atom.atomic_number = Z;
-        atom.x             = x;
-        atom.y             = y;
-        atom.z             = z;
-        return atom;
-    };
-
-    /// Origin for shell construction
-    std::array<double, 3> origin = {0.0, 0.0, 0.0};
-
-    /// Convert centers and their shells to libint equivalents.
-    for(decltype(bs.size()) abs_i = 0; abs_i < bs.size(); ++abs_i) {
-        /// Add current center to atoms list
-        const auto& abs = bs[abs_i];
-        centers.push_back(atom_ctor(abs_i, abs.center().x(), abs.center().y(),
-                                    abs.center().z()));
-
-        /// Gather shells for this center and add them to element_bases
-        atom_bases_t atom_bases{};
-        for(const auto&& shelli : abs) {
-            const auto nprims = shelli.n_primitives();
-            const auto prim0  = shelli.primitive(0);
-            const auto primN  = shelli.primitive(nprims - 1);
-            const bool pure   = shelli.pure() == chemist::ShellType::pure;
-            const int l       = shelli.l();
-
-            svec_d_t alphas(&prim0.exponent(), &primN.exponent() + 1);
-            svec_d_t coefs(&prim0.coefficient(), &primN.coefficient() + 1);
-            conts_t conts{cont_t{l, pure, coefs}};
-            /// Use origin for position, because BasisSet moves shells to center
-            atom_bases.push_back(shell_t(alphas, conts, origin));
-        }
-        element_bases.push_back(atom_bases);
-    }
-
-    /// Return the new basis set
-    return basis_t(centers, element_bases);
-}
-
 MODULE_CTOR(TAMMEnergy) {
     satisfies_property_type<energy_pt>();
 
@@ -226,7 +168,7 @@ MODULE_RUN(TAMMEnergy) {
 
     const double angstrom_to_bohr = 1.8897259878858;
 
-    libint2::BasisSet li_shells = make_libint_basis(aos);
+    libint2::BasisSet li_shells = utilities::make_libint_basis(aos);
 
     ChemEnv chem_env;
     chem_env.input_file = inputs.at("molecule_name").value<std::string>();
@@ -0,0 +1,199 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../guess/guess_common.hpp"
+#include "gdm.hpp"
+#include "update.hpp"
+#include "update_history.hpp"
+
+namespace scf::update {
+namespace {
+const auto desc = R"(
+Geometric Direct Minimization Update
+------------------------------------
+
+Updates the orbitals by a quasi-Newton step on the energy instead of by
+diagonalizing the Fock matrix. The new orbitals are C exp(K), where the
+antisymmetric K holds the occupied-virtual rotation parameters kappa_ai. In
+the basis of the current orbitals the energy gradient is 4 F_ai, and the
+step is taken by L-BFGS (keeping "BFGS history" pairs) on top of the
+diagonal Hessian 4 (F_aa - F_ii), with the orbital energy gaps floored at
+"minimum gap". Steps longer than "max step" are scaled back. exp(K) is
+applied in closed form from the SVD of kappa (see rotate_orbitals).
+
+Since every step starts from the orbitals of the previous one, the BFGS
+history is carried over from one update to the next. The module returns it
+as the "update history" result and the caller (e.g., the SCF loop) passes it
+back as the "update history" input of the next update, which must start from
+the orbitals this one returned. With an empty history the update is a
+preconditioned steepest-descent step.
+
+The returned "orbital energies" are the diagonal elements of the Fock matrix
+in the new orbitals, which are not canonical. If the old guess has no
+orbitals yet there is nothing to rotate, and the orbitals come from one
+generalized diagonalization by the "Diagonalizer" submodule instead.
+
+Only double-precision Fock matrices are supported.
+)";
+
+} // namespace
+
+using rscf_wf         = simde::type::rscf_wf;
+using fock_matrix_pt  = simde::aos_f_e_aos;
+using pt              = simde::UpdateGuess<rscf_wf>;
+using diagonalizer_pt = simde::GeneralizedEigenSolve;
+using s_pt            = simde::aos_s_e_aos;
+
+MODULE_CTOR(GDM) {
+    description(desc);
+    satisfies_property_type<pt>();
+    add_submodule<fock_matrix_pt>("Fock matrix builder");
+    add_submodule<diagonalizer_pt>("Diagonalizer");
+    add_submodule<s_pt>("Overlap matrix builder");
+
+    add_input<double>("max step")
+      .set_default(0.5)
+      .set_description("Largest norm of the rotation parameters of one step");
+    add_input<double>("minimum gap")
+      .set_default(0.1)
+      .set_description("Smallest orbital energy gap used in the diagonal "
+                       "Hessian");
+    const std::size_t history_default = 10;
+    add_input<std::size_t>("BFGS history")
+      .set_default(history_default)
+      .set_description("Number of previous steps the L-BFGS update keeps");
+    add_input<simde::type::tensor>(history_key)
+      .set_default(simde::type::tensor{})
+      .set_description("History returned by the previous update (empty to "
+                       "start a new one)");
+    add_result<simde::type::tensor>(history_key)
+      .set_description("History for the next update");
+}
+
+MODULE_RUN(GDM) {
+    using simde::type::tensor;
+    using matrix_type = Eigen::MatrixXd;
+    using vector_type = Eigen::VectorXd;
+    using row_major =
+      Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+    const auto&& [f, old_guess] = pt::unwrap_inputs(inputs);
+    const auto max_step  = inputs.at("max step").value<double>();
+    const auto min_gap   = inputs.at("minimum gap").value<double>();
+    const auto n_history = inputs.at("BFGS history").value<std::size_t>();
+    const auto& history  = inputs.at(history_key).value<tensor>();
+    const auto& aos      = old_guess.orbitals().from_space();
+
+    chemist::braket::BraKet f_mn(aos, f, aos);
+    auto& fock_matrix_mod = submods.at("Fock matrix builder");
+    const auto& f_matrix  = fock_matrix_mod.run_as<fock_matrix_pt>(f_mn);
+
+    // Nothing to rotate yet: fall back to one diagonalization
+    const auto& C_old = old_guess.orbitals().transform();
+    if(C_old == tensor{}) {
+        chemist::braket::BraKet s_mn(aos, simde::type::s_e_type{}, aos);
+        auto& s_mod          = submods.at("Overlap matrix builder");
+        const auto& s_matrix = s_mod.run_as<s_pt>(s_mn);
+
+        auto& diagonalizer_mod = submods.at("Diagonalizer");
+        const auto&& [evalues, evectors] =
+          diagonalizer_mod.run_as<diagonalizer_pt>(f_matrix, s_matrix);
+        simde::type::cmos cmos(evalues, aos, evectors);
+        rscf_wf new_guess(old_guess.orbital_indices(), cmos);
+
+        auto rv = results();
+        rv.at(history_key).change(tensor{});
+        return pt::wrap_results(rv, new_guess);
+    }
+
+    // Step 1: Fock matrix in the current orbitals
+    const auto C_data = guess::to_doubles(C_old);
+    const auto F_data = guess::to_doubles(f_matrix);
+    const auto n_ao   = aos.ao_basis_set().n_aos();
+    const auto n_mo   = C_data.size() / n_ao;
+    const auto n_ao_  = static_cast<Eigen::Index>(n_ao);
+    const auto n_mo_  = static_cast<Eigen::Index>(n_mo);
+    const matrix_type C =
+      Eigen::Map<const row_major>(C_data.data(), n_ao_, n_mo_);
+    const matrix_type F =
+      Eigen::Map<const row_major>(F_data.data(), n_ao_, n_ao_);
+    const matrix_type F_mo = C.transpose() * F * C;
+
+    std::vector<bool> is_occ(n_mo, false);
+    for(auto i : old_guess.orbital_indices()) is_occ.at(i) = true;
+    std::vector<std::size_t> occ, vir;
+    for(std::size_t p = 0; p < n_mo; ++p) (is_occ[p] ? occ : vir).push_back(p);
+    const auto n_occ = static_cast<Eigen::Index>(occ.size());
+    const auto n_vir = static_cast<Eigen::Index>(vir.size());
+
+    // Step 2: Gradient and diagonal inverse Hessian, vectorized column-major
+    vector_type g(n_vir * n_occ), h0_inv(n_vir * n_occ);
+    for(Eigen::Index i = 0; i < n_occ; ++i) {
+        for(Eigen::Index a = 0; a < n_vir; ++a) {
+            const auto ii  = occ[i];
+            const auto aa  = vir[a];
+            const auto gap = std::max(F_mo(aa, aa) - F_mo(ii, ii), min_gap);
+
+            g[i * n_vir + a]      = 4.0 * F_mo(aa, ii);
+            h0_inv[i * n_vir + a] = 1.0 / (4.0 * gap);
+        }
+    }
+
+    // Step 3: L-BFGS step, continuing the history if there is one
+    const auto n_vo = occ.size() * vir.size();
+    std::optional<GDMHistory> state;
+    if(history != tensor{})
+        state = GDMHistory::unpack(guess::to_doubles(history), n_vo, n_history);
+    LBFGS lbfgs(n_history);
+    if(state) {
+        lbfgs = state->lbfgs;
+        lbfgs.push(state->step, g - state->gradient);
+    }
+    vector_type d = lbfgs.step(g, h0_inv);
+    if(d.dot(g) >= 0.0) {
+        lbfgs.clear();
+        d = -h0_inv.cwiseProduct(g);
+    }
+    const auto d_norm = d.norm();
+    if(d_norm > max_step) d *= max_step / d_norm;
+
+    // Step 4: Rotate the orbitals
+    const matrix_type kappa =
+      Eigen::Map<const matrix_type>(d.data(), n_vir, n_occ);
+    const matrix_type C_new = rotate_orbitals(C, kappa, occ, vir);
+    const vector_type e_new =
+      (C_new.transpose() * F * C_new).diagonal().eval();
+
+    const row_major C_out = C_new;
+    std::vector<double> C_new_data(C_out.data(), C_out.data() + n_ao * n_mo);
+    std::vector<double> e_data(e_new.data(), e_new.data() + n_mo);
+    const auto new_history = GDMHistory{g, d, std::move(lbfgs)}.pack();
+
+    using tensorwrapper::utilities::make_tensor;
+    simde::type::cmos cmos(make_tensor({n_mo}, e_data), aos,
+                           make_tensor({n_ao, n_mo}, C_new_data));
+    rscf_wf new_guess(old_guess.orbital_indices(), cmos);
+
+    auto rv = results();
+    if(n_vo == 0)
+        rv.at(history_key).change(tensor{});
+    else
+        rv.at(history_key)
+          .change(make_tensor({new_history.size() / n_vo, n_vo}, new_history));
+    return pt::wrap_results(rv, new_guess);
+}
+
+} // namespace scf::update
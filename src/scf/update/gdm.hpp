@@ -0,0 +1,212 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <vector>
+
+namespace scf::update {
+
+/** @brief Limited-memory BFGS with a diagonal initial inverse Hessian.
+ *
+ *  Keeps the last @p max_pairs (step, gradient change) pairs and applies the
+ *  resulting inverse Hessian to a gradient by the two-loop recursion. Pairs
+ *  which violate the curvature condition s^T y > 0 are not stored, so the
+ *  inverse Hessian stays positive definite.
+ */
+class LBFGS {
+public:
+    using vector_type = Eigen::VectorXd;
+
+    explicit LBFGS(std::size_t max_pairs = 10) : m_max_pairs_(max_pairs) {}
+
+    /// Records step @p s and the change @p y in the gradient it caused
+    void push(const vector_type& s, const vector_type& y) {
+        const double sy = s.dot(y);
+        if(!(sy > 1.0E-12 * s.norm() * y.norm())) return;
+        m_pairs_.push_back({s, y, 1.0 / sy});
+        if(m_pairs_.size() > m_max_pairs_) m_pairs_.pop_front();
+    }
+
+    /// Number of stored pairs
+    std::size_t size() const { return m_pairs_.size(); }
+
+    /// Step of the @p k-th stored pair (oldest first)
+    const vector_type& s(std::size_t k) const { return m_pairs_.at(k).s; }
+
+    /// Gradient change of the @p k-th stored pair (oldest first)
+    const vector_type& y(std::size_t k) const { return m_pairs_.at(k).y; }
+
+    /// Forgets all pairs
+    void clear() { m_pairs_.clear(); }
+
+    /// The quasi-Newton step -H^-1 @p g, with H0^-1 = diag(@p h0_inv)
+    vector_type step(const vector_type& g, const vector_type& h0_inv) const {
+        vector_type q = g;
+        std::vector<double> alpha(m_pairs_.size());
+        for(std::size_t k = m_pairs_.size(); k-- > 0;) {
+            const auto& p = m_pairs_[k];
+            alpha[k]      = p.rho * p.s.dot(q);
+            q -= alpha[k] * p.y;
+        }
+        vector_type r = h0_inv.cwiseProduct(q);
+        for(std::size_t k = 0; k < m_pairs_.size(); ++k) {
+            const auto& p     = m_pairs_[k];
+            const double beta = p.rho * p.y.dot(r);
+            r += (alpha[k] - beta) * p.s;
+        }
+        return -r;
+    }
+
+private:
+    struct Pair {
+        vector_type s, y;
+        double rho;
+    };
+
+    std::size_t m_max_pairs_;
+    std::deque<Pair> m_pairs_;
+};
+
+/** @brief The orbitals @p C exp(K) for the occupied-virtual rotation @p kappa.
+ *
+ *  K is the antisymmetric n_mo by n_mo matrix with K(a, i) = kappa(a, i)
+ *  and K(i, a) = -kappa(a, i), where i runs over @p occ and a over @p vir.
+ *  With the thin SVD kappa = U sigma V^T the exponential has the closed form
+ *
+ *    exp(K)_oo = 1 + V (cos(sigma) - 1) V^T,  exp(K)_vo = U sin(sigma) V^T,
+ *    exp(K)_vv = 1 + U (cos(sigma) - 1) U^T,  exp(K)_ov = -V sin(sigma) U^T,
+ *
+ *  so exp(K) is never formed: the cost is the O(n_occ^2 n_vir) SVD plus
+ *  low-rank updates of the columns of @p C.
+ *
+ *  @param[in] C The n_ao by n_mo orbitals to rotate.
+ *  @param[in] kappa The n_vir by n_occ rotation parameters.
+ *  @param[in] occ The indices of the occupied orbitals.
+ *  @param[in] vir The indices of the virtual orbitals.
+ */
+inline Eigen::MatrixXd rotate_orbitals(const Eigen::MatrixXd& C,
+                                       const Eigen::MatrixXd& kappa,
+                                       const std::vector<std::size_t>& occ,
+                                       const std::vector<std::size_t>& vir) {
+    using matrix_type = Eigen::MatrixXd;
+    const auto n_ao   = C.rows();
+    const auto n_occ  = static_cast<Eigen::Index>(occ.size());
+    const auto n_vir  = static_cast<Eigen::Index>(vir.size());
+
+    matrix_type C_occ(n_ao, n_occ), C_vir(n_ao, n_vir);
+    for(Eigen::Index i = 0; i < n_occ; ++i) C_occ.col(i) = C.col(occ[i]);
+    for(Eigen::Index a = 0; a < n_vir; ++a) C_vir.col(a) = C.col(vir[a]);
+
+    Eigen::JacobiSVD<matrix_type> svd(
+      kappa, Eigen::ComputeThinU | Eigen::ComputeThinV);
+    const auto& U                 = svd.matrixU();
+    const auto& V                 = svd.matrixV();
+    const Eigen::ArrayXd sigma    = svd.singularValues().array();
+    const Eigen::VectorXd cos_m_1 = (sigma.cos() - 1.0).matrix();
+    const Eigen::VectorXd sin_s   = sigma.sin().matrix();
+
+    const matrix_type CV = C_occ * V;
+    const matrix_type CU = C_vir * U;
+    const matrix_type new_occ =
+      C_occ +
+      (CV * cos_m_1.asDiagonal() + CU * sin_s.asDiagonal()) * V.transpose();
+    const matrix_type new_vir =
+      C_vir +
+      (CU * cos_m_1.asDiagonal() - CV * sin_s.asDiagonal()) * U.transpose();
+
+    matrix_type C_new = C;
+    for(Eigen::Index i = 0; i < n_occ; ++i) C_new.col(occ[i]) = new_occ.col(i);
+    for(Eigen::Index a = 0; a < n_vir; ++a) C_new.col(vir[a]) = new_vir.col(a);
+    return C_new;
+}
+
+/** @brief The unitary exp(K) for the occupied-virtual rotation @p kappa.
+ *
+ *  Same as rotate_orbitals() applied to the n_mo by n_mo identity.
+ */
+inline Eigen::MatrixXd exp_rotation(const Eigen::MatrixXd& kappa,
+                                    const std::vector<std::size_t>& occ,
+                                    const std::vector<std::size_t>& vir,
+                                    std::size_t n_mo) {
+    const auto n = static_cast<Eigen::Index>(n_mo);
+    return rotate_orbitals(Eigen::MatrixXd::Identity(n, n), kappa, occ, vir);
+}
+
+/** @brief State which GDM carries from one orbital update to the next.
+ *
+ *  An UpdateGuess module only sees the current orbitals and their Fock
+ *  operator, so GDM returns its history as the "update history" result and
+ *  takes it back as the input of the same name (see update_history.hpp).
+ *  Whoever drives the updates, e.g., the SCF loop, owns it, and must only
+ *  pass it back to an update which starts from the orbitals it came with.
+ *  The previous steps and gradients are kept as occupied-virtual parameters
+ *  and are reused in the frame of the new orbitals, which is the usual GDM
+ *  approximation to parallel transporting them.
+ *
+ *  As a tensor the history is an n_rows by n_vo matrix whose rows are the
+ *  last gradient, the last step, and then s and y of each L-BFGS pair,
+ *  oldest first.
+ */
+struct GDMHistory {
+    using vector_type = LBFGS::vector_type;
+
+    vector_type gradient;
+    vector_type step;
+    LBFGS lbfgs;
+
+    /// The rows of the history, flattened row-major
+    std::vector<double> pack() const {
+        std::vector<double> rv;
+        auto append = [&rv](const vector_type& v) {
+            rv.insert(rv.end(), v.data(), v.data() + v.size());
+        };
+        append(gradient);
+        append(step);
+        for(std::size_t k = 0; k < lbfgs.size(); ++k) {
+            append(lbfgs.s(k));
+            append(lbfgs.y(k));
+        }
+        return rv;
+    }
+
+    /** @brief Inverse of pack() for @p n_vo rotation parameters.
+     *
+     *  @return The history, or nothing if @p rows does not hold one for
+     *          @p n_vo parameters (e.g., if it is empty).
+     */
+    static std::optional<GDMHistory> unpack(const std::vector<double>& rows,
+                                            std::size_t n_vo,
+                                            std::size_t max_pairs) {
+        if(n_vo == 0 || rows.size() % (2 * n_vo) != 0 || rows.empty())
+            return std::nullopt;
+        const auto n = static_cast<Eigen::Index>(n_vo);
+        auto row     = [&](std::size_t r) -> vector_type {
+            return Eigen::Map<const vector_type>(rows.data() + r * n_vo, n);
+        };
+        GDMHistory rv{row(0), row(1), LBFGS(max_pairs)};
+        for(std::size_t r = 2; r < rows.size() / n_vo; r += 2)
+            rv.lbfgs.push(row(r), row(r + 1));
+        return rv;
+    }
+};
+
+} // namespace scf::update
@@ -20,9 +20,11 @@
 namespace scf::update {
 
 DECLARE_MODULE(Diagonalization);
+DECLARE_MODULE(GDM);
 
 inline void load_modules(pluginplay::ModuleManager& mm) {
     mm.add_module<Diagonalization>("Diagonalization Fock update");
+    mm.add_module<GDM>("GDM Fock update");
 }
 
 inline void set_defaults(pluginplay::ModuleManager& mm) {
@@ -30,6 +32,11 @@ inline void set_defaults(pluginplay::ModuleManager& mm) {
                      "Generalized eigensolve via Eigen");
     mm.change_submod("Diagonalization Fock update", "Fock matrix builder",
                      "Fock matrix builder");
+
+    mm.change_submod("GDM Fock update", "Diagonalizer",
+                     "Generalized eigensolve via Eigen");
+    mm.change_submod("GDM Fock update", "Fock matrix builder",
+                     "Fock matrix builder");
 }
 
 } // namespace scf::update
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <simde/simde.hpp>
+#include <string>
+#include <utility>
+
+namespace scf::update {
+
+/// Input and result key for the state a guess updater carries between steps
+inline const std::string history_key = "update history";
+
+/// Does the module behind @p submod carry state from one update to the next?
+inline bool keeps_history(const pluginplay::SubmoduleRequest& submod) {
+    return submod.has_module() && submod.value().inputs().count(history_key);
+}
+
+/** @brief Runs the guess updater @p submod, threading its history through.
+ *
+ *  Updaters such as GDM take a step which depends on the previous ones. The
+ *  property type does not know about that, so such updaters declare an
+ *  input and a result named history_key: the history the update starts
+ *  from, and the one the next update should start from. The caller owns
+ *  the history; an empty tensor starts a new one. If the updater keeps a
+ *  history, this function passes it @p history and replaces @p history by
+ *  the returned one. Otherwise only the property type inputs are set.
+ *
+ *  @tparam PropertyType The property type to run @p submod as.
+ *
+ *  @param[in] submod The guess updater.
+ *  @param[in,out] history The history of the previous update, replaced by
+ *                         the history of this one.
+ *  @param[in] args The inputs for @p PropertyType.
+ *
+ *  @return The results of @p PropertyType.
+ */
+template<typename PropertyType, typename... Args>
+auto run_with_history(pluginplay::SubmoduleRequest& submod,
+                      simde::type::tensor& history, Args&&... args) {
+    const auto& mod_inputs = submod.value().inputs();
+    auto inputs =
+      PropertyType::wrap_inputs(mod_inputs, std::forward<Args>(args)...);
+    const bool stateful = keeps_history(submod);
+    if(stateful) inputs.at(history_key).change(history);
+    auto results = submod.run(inputs);
+    if(stateful)
+        history = results.at(history_key).template value<simde::type::tensor>();
+    return PropertyType::unwrap_results(results);
+}
+
+} // namespace scf::update
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <simde/simde.hpp>
+#include <utility>
+
+namespace scf::utilities {
+
+/// Wraps converting an AOBasisSet to a simde::type::molecule
+inline simde::type::molecule aos2molecule(
+  const simde::type::ao_basis_set& aos) {
+    simde::type::molecule mol;
+    using atom_type = typename chemist::Molecule::atom_type;
+    for(const auto& atomic_bs : aos) {
+        const auto& center = atomic_bs.center();
+        auto Z             = atomic_bs.atomic_number().value();
+        atom_type a("X", Z, 1.0, center.x(), center.y(), center.z());
+        mol.push_back(std::move(a));
+    }
+    return mol;
+}
+
+} // namespace scf::utilities
@@ -0,0 +1,357 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "parallel_for.hpp"
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <simde/simde.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace scf::utilities {
+
+/** @brief Block boundaries of a tiled matrix dimension.
+ *
+ *  Block I spans rows (and columns) [offsets[I], offsets[I + 1]), so the
+ *  first element is 0 and the last one is the dimension.
+ */
+using block_offsets = std::vector<std::size_t>;
+
+/// One block per shell of @p bs
+inline block_offsets shell_offsets(const simde::type::ao_basis_set& bs) {
+    block_offsets rv{0};
+    for(std::size_t s = 0; s < bs.n_shells(); ++s)
+        rv.push_back(rv.back() + bs.shell(s).size());
+    return rv;
+}
+
+/// One block per center (atom) of @p bs
+inline block_offsets atom_offsets(const simde::type::ao_basis_set& bs) {
+    block_offsets rv{0};
+    for(std::size_t c = 0; c < bs.size(); ++c)
+        rv.push_back(rv.back() + bs[c].n_aos());
+    return rv;
+}
+
+/** @brief A square matrix stored as its significant blocks only.
+ *
+ *  The matrix is tiled by @p offsets in both dimensions. Each block row keeps
+ *  a column-sorted list of its non-negligible blocks, each a dense row-major
+ *  tile together with its Frobenius norm (block compressed sparse row).
+ *  Memory and the cost of multiplication then scale with the number of
+ *  significant blocks. Blocks are dropped when their norm falls below the
+ *  threshold given to from_dense() or multiply(), and products of blocks
+ *  whose norms multiply to less than it are never formed.
+ *
+ *  @tparam FloatType A non-UQ floating point type.
+ */
+template<typename FloatType>
+class BlockSparseMatrix {
+public:
+    using value_type = FloatType;
+    using size_type  = std::size_t;
+
+    struct Block {
+        size_type col;
+        double norm;
+        std::vector<value_type> data;
+    };
+
+    using block_row = std::vector<Block>;
+
+    /// An all-zero matrix tiled by @p offsets
+    explicit BlockSparseMatrix(block_offsets offsets) :
+      m_offsets_(std::move(offsets)),
+      m_rows_(m_offsets_.empty() ? 0 : m_offsets_.size() - 1) {
+        if(m_offsets_.empty() || m_offsets_.front() != 0)
+            throw std::runtime_error("Block offsets must start at 0");
+    }
+
+    /// Keeps the blocks of the row-major matrix @p A with norm >= @p thresh
+    static BlockSparseMatrix from_dense(const value_type* A,
+                                        block_offsets offsets, double thresh) {
+        BlockSparseMatrix rv(std::move(offsets));
+        const auto n = rv.dimension();
+        for(size_type I = 0; I < rv.n_block_rows(); ++I) {
+            for(size_type J = 0; J < rv.n_block_rows(); ++J) {
+                Block block{J, 0.0, {}};
+                block.data.reserve(rv.block_size(I) * rv.block_size(J));
+                for(auto i = rv.m_offsets_[I]; i < rv.m_offsets_[I + 1]; ++i)
+                    for(auto j = rv.m_offsets_[J]; j < rv.m_offsets_[J + 1];
+                        ++j)
+                        block.data.push_back(A[i * n + j]);
+                block.norm = frobenius_(block.data);
+                if(block.norm >= thresh && block.norm > 0.0)
+                    rv.m_rows_[I].push_back(std::move(block));
+            }
+        }
+        return rv;
+    }
+
+    /// Dimension of the (square) matrix
+    size_type dimension() const noexcept { return m_offsets_.back(); }
+
+    /// Number of block rows (and columns)
+    size_type n_block_rows() const noexcept { return m_rows_.size(); }
+
+    /// Number of rows in block row @p I
+    size_type block_size(size_type I) const {
+        return m_offsets_[I + 1] - m_offsets_[I];
+    }
+
+    const block_offsets& offsets() const noexcept { return m_offsets_; }
+
+    /// The stored blocks of block row @p I, sorted by column
+    const block_row& row(size_type I) const { return m_rows_[I]; }
+
+    /// Number of stored blocks
+    size_type n_blocks() const noexcept {
+        size_type rv = 0;
+        for(const auto& r : m_rows_) rv += r.size();
+        return rv;
+    }
+
+    /// Number of stored elements
+    size_type n_elements() const noexcept {
+        size_type rv = 0;
+        for(const auto& r : m_rows_)
+            for(const auto& b : r) rv += b.data.size();
+        return rv;
+    }
+
+    /// Frobenius norm of the whole matrix
+    double norm() const noexcept {
+        double rv = 0.0;
+        for(const auto& r : m_rows_)
+            for(const auto& b : r) rv += b.norm * b.norm;
+        return std::sqrt(rv);
+    }
+
+    /// sum_ij this_ij X_ij, over the blocks stored in both matrices
+    double dot(const BlockSparseMatrix& X) const {
+        check_tiling_(X);
+        double rv = 0.0;
+        for(size_type I = 0; I < n_block_rows(); ++I) {
+            const auto& a = m_rows_[I];
+            const auto& x = X.m_rows_[I];
+            std::size_t p = 0, q = 0;
+            while(p < a.size() && q < x.size()) {
+                if(a[p].col < x[q].col) {
+                    ++p;
+                } else if(x[q].col < a[p].col) {
+                    ++q;
+                } else {
+                    for(size_type k = 0; k < a[p].data.size(); ++k)
+                        rv += double(a[p].data[k]) * double(x[q].data[k]);
+                    ++p;
+                    ++q;
+                }
+            }
+        }
+        return rv;
+    }
+
+    /// Writes the matrix, dropped blocks as zeros, to the row-major @p out
+    void to_dense(value_type* out) const {
+        const auto n = dimension();
+        std::fill(out, out + n * n, value_type(0.0));
+        for(size_type I = 0; I < n_block_rows(); ++I) {
+            for(const auto& b : m_rows_[I]) {
+                const auto n_j = block_size(b.col);
+                const auto* x  = b.data.data();
+                for(auto i = m_offsets_[I]; i < m_offsets_[I + 1]; ++i) {
+                    auto* out_i = out + i * n + m_offsets_[b.col];
+                    std::copy(x, x + n_j, out_i);
+                    x += n_j;
+                }
+            }
+        }
+    }
+
+    std::vector<value_type> to_dense() const {
+        std::vector<value_type> rv(dimension() * dimension());
+        to_dense(rv.data());
+        return rv;
+    }
+
+    /** @brief this + alpha * X.
+     *
+     *  The result stores the union of both block patterns.
+     */
+    BlockSparseMatrix add(const BlockSparseMatrix& X, value_type alpha) const {
+        check_tiling_(X);
+        BlockSparseMatrix rv(m_offsets_);
+        for(size_type I = 0; I < n_block_rows(); ++I) {
+            const auto& a = m_rows_[I];
+            const auto& x = X.m_rows_[I];
+            auto& out     = rv.m_rows_[I];
+            std::size_t p = 0, q = 0;
+            while(p < a.size() || q < x.size()) {
+                if(q == x.size() || (p < a.size() && a[p].col < x[q].col)) {
+                    out.push_back(a[p++]);
+                } else {
+                    Block b{x[q].col, 0.0, x[q].data};
+                    for(auto& v : b.data) v *= alpha;
+                    if(p < a.size() && a[p].col == x[q].col) {
+                        for(size_type k = 0; k < b.data.size(); ++k)
+                            b.data[k] += a[p].data[k];
+                        ++p;
+                    }
+                    b.norm = frobenius_(b.data);
+                    out.push_back(std::move(b));
+                    ++q;
+                }
+            }
+        }
+        return rv;
+    }
+
+    /// The transpose, with the same tiling
+    BlockSparseMatrix transpose() const {
+        BlockSparseMatrix rv(m_offsets_);
+        for(size_type I = 0; I < n_block_rows(); ++I) {
+            for(const auto& b : m_rows_[I]) {
+                Block t{I, b.norm, {}};
+                t.data.resize(b.data.size());
+                matrix_map_(t.data.data(), block_size(b.col), block_size(I)) =
+                  const_matrix_map_(b.data.data(), block_size(I),
+                                    block_size(b.col))
+                    .transpose();
+                rv.m_rows_[b.col].push_back(std::move(t));
+            }
+        }
+        return rv; // Rows are filled in increasing I, so they stay sorted
+    }
+
+    /** @brief this * B, skipping negligible block products.
+     *
+     *  C_IJ = sum_K A_IK B_KJ where terms with ||A_IK|| ||B_KJ|| < @p thresh
+     *  are skipped, and result blocks with norm below @p thresh are dropped.
+     *  Block rows of the result are formed concurrently, on up to
+     *  @p max_threads threads (0 means all).
+     */
+    BlockSparseMatrix multiply(const BlockSparseMatrix& B, double thresh,
+                               size_type max_threads = 0) const {
+        check_tiling_(B);
+        BlockSparseMatrix rv(m_offsets_);
+        const auto n_blocks = n_block_rows();
+
+        auto rows = [&](size_type begin, size_type end) {
+            // slot[J] is J's position in acc, or -1 if J isn't touched yet
+            std::vector<long> slot(n_blocks, -1);
+            std::vector<Block> acc;
+            for(auto I = begin; I < end; ++I) {
+                const auto n_i = block_size(I);
+                for(const auto& a : m_rows_[I]) {
+                    const auto K    = a.col;
+                    const auto n_k  = block_size(K);
+                    const auto A_IK = const_matrix_map_(a.data.data(), n_i,
+                                                        n_k);
+                    for(const auto& b : B.m_rows_[K]) {
+                        if(a.norm * b.norm < thresh) continue;
+                        const auto J   = b.col;
+                        const auto n_j = block_size(J);
+                        if(slot[J] < 0) {
+                            slot[J] = static_cast<long>(acc.size());
+                            acc.push_back(Block{
+                              J, 0.0, std::vector<value_type>(n_i * n_j)});
+                        }
+                        auto C_IJ =
+                          matrix_map_(acc[slot[J]].data.data(), n_i, n_j);
+                        C_IJ.noalias() +=
+                          A_IK * const_matrix_map_(b.data.data(), n_k, n_j);
+                    }
+                }
+
+                std::sort(acc.begin(), acc.end(),
+                          [](const auto& x, const auto& y) {
+                              return x.col < y.col;
+                          });
+                for(auto& c : acc) {
+                    slot[c.col] = -1;
+                    c.norm      = frobenius_(c.data);
+                    if(c.norm >= thresh && c.norm > 0.0)
+                        rv.m_rows_[I].push_back(std::move(c));
+                }
+                acc.clear();
+            }
+        };
+        parallel_for(n_blocks, rows, max_threads);
+        return rv;
+    }
+
+private:
+    using matrix_type = Eigen::Matrix<value_type, Eigen::Dynamic,
+                                      Eigen::Dynamic, Eigen::RowMajor>;
+
+    static auto matrix_map_(value_type* p, size_type rows, size_type cols) {
+        return Eigen::Map<matrix_type>(p, rows, cols);
+    }
+
+    static auto const_matrix_map_(const value_type* p, size_type rows,
+                                  size_type cols) {
+        return Eigen::Map<const matrix_type>(p, rows, cols);
+    }
+
+    static double frobenius_(const std::vector<value_type>& x) {
+        double rv = 0.0;
+        for(const auto& v : x) rv += double(v) * double(v);
+        return std::sqrt(rv);
+    }
+
+    void check_tiling_(const BlockSparseMatrix& other) const {
+        if(other.m_offsets_ != m_offsets_)
+            throw std::runtime_error("Block sparse matrices are tiled "
+                                     "differently");
+    }
+
+    block_offsets m_offsets_;
+    std::vector<block_row> m_rows_;
+};
+
+/** @brief Zeros the blocks of the row-major, n by n matrix @p A whose norm
+ *         is below @p thresh.
+ *
+ *  @return The number of blocks kept.
+ */
+template<typename FloatType>
+std::size_t screen_blocks(FloatType* A, const block_offsets& offsets,
+                          double thresh) {
+    const auto n        = offsets.back();
+    const auto n_blocks = offsets.size() - 1;
+    std::size_t n_kept  = 0;
+    for(std::size_t I = 0; I < n_blocks; ++I) {
+        for(std::size_t J = 0; J < n_blocks; ++J) {
+            double norm2 = 0.0;
+            for(auto i = offsets[I]; i < offsets[I + 1]; ++i)
+                for(auto j = offsets[J]; j < offsets[J + 1]; ++j)
+                    norm2 += double(A[i * n + j]) * double(A[i * n + j]);
+            if(std::sqrt(norm2) >= thresh) {
+                ++n_kept;
+                continue;
+            }
+            for(auto i = offsets[I]; i < offsets[I + 1]; ++i)
+                for(auto j = offsets[J]; j < offsets[J + 1]; ++j)
+                    A[i * n + j] = FloatType(0.0);
+        }
+    }
+    return n_kept;
+}
+
+} // namespace scf::utilities
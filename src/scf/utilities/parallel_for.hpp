@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace scf::utilities {
+
+/** @brief The number of threads to use when the caller does not specify one.
+ *
+ *  @return The hardware concurrency, or 1 if it can not be determined.
+ */
+inline std::size_t default_n_threads() {
+    const auto n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+}
+
+/** @brief Splits [0, n) into contiguous chunks and processes them concurrently.
+ *
+ *  @p f is called as f(begin, end) once per chunk, with chunks covering [0, n)
+ *  without overlap. The first chunk runs on the calling thread. Chunks must
+ *  not write to the same memory. If any call throws, the exception from the
+ *  lowest-numbered chunk is rethrown after all threads have been joined.
+ *
+ *  @param[in] n The number of work items.
+ *  @param[in] f The callable processing the range [begin, end).
+ *  @param[in] max_threads The maximum number of threads to use. 0 means
+ *                         default_n_threads().
+ */
+template<typename FunctionType>
+void parallel_for(std::size_t n, FunctionType&& f,
+                  std::size_t max_threads = 0) {
+    if(n == 0) return;
+    if(max_threads == 0) max_threads = default_n_threads();
+    const auto n_chunks = std::min(n, max_threads);
+    if(n_chunks == 1) {
+        f(std::size_t{0}, n);
+        return;
+    }
+
+    const auto chunk_size = n / n_chunks;
+    const auto remainder  = n % n_chunks;
+    auto chunk_begin      = [=](std::size_t c) {
+        return c * chunk_size + std::min(c, remainder);
+    };
+
+    std::vector<std::exception_ptr> errors(n_chunks);
+    auto run_chunk = [&](std::size_t c) {
+        try {
+            f(chunk_begin(c), chunk_begin(c + 1));
+        } catch(...) { errors[c] = std::current_exception(); }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(n_chunks - 1);
+    for(std::size_t c = 1; c < n_chunks; ++c) {
+        threads.emplace_back(run_chunk, c);
+    }
+    run_chunk(0);
+    for(auto& t : threads) t.join();
+
+    for(auto& e : errors) {
+        if(e) std::rethrow_exception(e);
+    }
+}
+
+} // namespace scf::utilities
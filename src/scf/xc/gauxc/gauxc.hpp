@@ -35,6 +35,17 @@ DECLARE_MODULE(MoleculeConversion);
 // Modules to generate XC Quadrature Batches
 DECLARE_MODULE(QuadratureBatches);
 
+/** @brief The fraction of exact (Hartree-Fock) exchange in @p func.
+ *
+ *  GauXC only evaluates the semilocal part of a hybrid functional, so the
+ *  Kohn-Sham operator has to add this fraction of K itself. The fraction is
+ *  taken from ExchCXX's definition of the functional and is 0 for pure
+ *  density functionals.
+ *
+ *  @throw std::out_of_range if GauXC does not support @p func.
+ */
+double exact_exchange_fraction(chemist::qm_operator::xc_functional func);
+
 void set_defaults(pluginplay::ModuleManager& mm);
 void load_modules(pluginplay::ModuleManager& mm);
 
@@ -40,6 +40,12 @@ ExchCXX::Functional nwx_to_exchcxx(xc_functional in) {
 
 #undef GAUXC_NWX_XC_PAIR
 
+double exact_exchange_fraction(xc_functional func) {
+    GauXC::functional_type xc(ExchCXX::Backend::builtin, nwx_to_exchcxx(func),
+                              ExchCXX::Spin::Unpolarized);
+    return xc.hyb_exx();
+}
+
 // XC Integration
 MODULE_CTOR(GauXCDriver) {
     satisfies_property_type<XCDriver>();
@@ -23,8 +23,27 @@ namespace scf::xc::gauxc {
 
 using k_type = simde::aos_k_e_aos;
 
+namespace {
+
+const auto desc = R"(
+sn-LinK Exchange
+----------------
+
+Evaluates the exchange matrix K seminumerically: one index of the
+two-electron integrals is integrated analytically and the other on the
+molecular grid, with linear-scaling screening of the grid batches.
+
+The grid and its load balancer come from the "Quadrature Batches" submodule.
+By default this is the same (memoized) module the GauXC XC driver uses, so
+for hybrid functionals the XC potential and K share a single partitioned
+grid per basis set.
+)";
+
+} // namespace
+
 // K Integration
 MODULE_CTOR(snLinK) {
+    description(desc);
     satisfies_property_type<k_type>();
 
     add_submodule<XCQuadratureBatches>("Quadrature Batches")
@@ -64,18 +64,6 @@ std::pair<int, int> to_libxc_codes(chemist::qm_operator::xc_functional func) {
 #endif
 }
 
-simde::type::molecule aos2molecule(const simde::type::ao_basis_set& aos) {
-    simde::type::molecule mol;
-    using atom_type = typename chemist::Molecule::atom_type;
-    for(const auto& atomic_bs : aos) {
-        const auto& center = atomic_bs.center();
-        auto Z             = atomic_bs.atomic_number().value();
-        atom_type a("X", Z, 1.0, center.x(), center.y(), center.z());
-        mol.push_back(std::move(a));
-    }
-    return mol;
-}
-
 simde::type::tensor libxc_lda_energy_density(
   chemist::qm_operator::xc_functional func,
   const simde::type::tensor& rho_on_grid) {
@@ -31,9 +31,6 @@ void load_modules(pluginplay::ModuleManager& mm);
  */
 std::pair<int, int> to_libxc_codes(chemist::qm_operator::xc_functional func);
 
-/// Wraps converting an AOBasisSet to a simde::type::molecule
-simde::type::molecule aos2molecule(const simde::type::ao_basis_set& aos);
-
 /** @brief Computes the energy density.
  *
  *  N.b. LibXC computes the energy per particle. This function will weight that
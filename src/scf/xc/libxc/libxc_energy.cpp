@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "../../utilities/aos2molecule.hpp"
 #include "libxc.hpp"
 #include <simde/simde.hpp>
 
@@ -56,7 +57,7 @@ MODULE_RUN(LibXCEnergy) {
     const auto& aos      = P.basis_set().ao_basis_set();
 
     // Molecule from AOs
-    const auto mol = libxc::aos2molecule(aos);
+    const auto mol = utilities::aos2molecule(aos);
 
     // Get grid
     auto& grid_mod   = submods.at("Integration grid");
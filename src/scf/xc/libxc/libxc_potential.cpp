@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "../../utilities/aos2molecule.hpp"
 #include "libxc.hpp"
 #include <simde/simde.hpp>
 
@@ -54,7 +55,7 @@ MODULE_RUN(LibXCPotential) {
 
     // Get grid
     auto& grid_mod   = submods.at("Integration grid");
-    const auto& grid = grid_mod.run_as<grid_pt>(libxc::aos2molecule(aos));
+    const auto& grid = grid_mod.run_as<grid_pt>(utilities::aos2molecule(aos));
 
     // Get AOs on the grid
     auto& aos_on_grid_mod   = submods.at("AOs on a grid");
@@ -15,6 +15,7 @@
  */
 
 #include "../integration_tests.hpp"
+#include <cmath>
 
 using Catch::Matchers::WithinAbs;
 
@@ -58,6 +59,22 @@ TEMPLATE_LIST_TEST_CASE("SCFLoop", "", test_scf::float_types) {
             tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
             REQUIRE(approximately_equal(corr, e, 1E-6));
         }
+
+        SECTION("Without reusing the core Hamiltonian") {
+            mod.change_input("core Hamiltonian cache", false);
+            const auto& [e, psi] = mod.template run_as<pt<wf_type>>(H_00, psi0);
+            pcorr.set_elem({}, float_type{-1.1167592336});
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-6));
+        }
+
+        SECTION("Block sparse gradient") {
+            mod.change_input("block sparse threshold", 1.0E-10);
+            const auto& [e, psi] = mod.template run_as<pt<wf_type>>(H_00, psi0);
+            pcorr.set_elem({}, float_type{-1.1167592336});
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-6));
+        }
     }
 
     SECTION("He") {
@@ -84,3 +101,53 @@ TEMPLATE_LIST_TEST_CASE("SCFLoop", "", test_scf::float_types) {
         }
     }
 }
+
+TEST_CASE("SCFLoop with GDM") {
+    using wf_type   = simde::type::rscf_wf;
+    using index_set = typename wf_type::orbital_index_set_type;
+    using update_pt = simde::UpdateGuess<wf_type>;
+
+    auto mm   = test_scf::load_modules<double>();
+    auto& mod = mm.at("Loop");
+    auto& gdm = mm.at("GDM Fock update");
+
+    // Forwards to GDM, counting the updates
+    std::size_t n_calls = 0;
+    auto counting_gdm   = pluginplay::make_lambda<update_pt>(
+      [&](auto&& f, auto&& psi) {
+          ++n_calls;
+          return gdm.run_as<update_pt>(f, psi);
+      });
+    mod.change_input("use guess updater", true);
+    mod.change_submod("Guess updater", counting_gdm);
+
+    // In a minimal basis the SCF orbitals of H2 are fixed by symmetry; start
+    // from them rotated by 0.3 rad so there is something to optimize
+    const auto cmos0 = test_scf::h2_cmos<double>();
+    using tensorwrapper::buffer::get_raw_data;
+    using tensorwrapper::buffer::make_contiguous;
+    const auto& c_buffer = make_contiguous(cmos0.transform().buffer());
+    const auto c0        = get_raw_data<double>(c_buffer);
+    const double cs = std::cos(0.3), sn = std::sin(0.3);
+    std::vector<double> c(4);
+    for(std::size_t mu = 0; mu < 2; ++mu) {
+        c[mu * 2 + 0] = cs * c0[mu * 2 + 0] + sn * c0[mu * 2 + 1];
+        c[mu * 2 + 1] = -sn * c0[mu * 2 + 0] + cs * c0[mu * 2 + 1];
+    }
+    using tensorwrapper::utilities::make_tensor;
+    simde::type::cmos cmos(cmos0.diagonalized_matrix(), test_scf::h2_aos(),
+                           make_tensor({2, 2}, c));
+    wf_type psi0(index_set{0}, cmos);
+
+    auto H = test_scf::h2_hamiltonian();
+    chemist::braket::BraKet H_00(psi0, H, psi0);
+    const auto& [e, psi] = mod.run_as<pt<wf_type>>(H_00, psi0);
+
+    tensorwrapper::shape::Smooth shape_corr{};
+    auto pcorr = make_contiguous<double>(shape_corr);
+    pcorr.set_elem({}, -1.1167592336);
+    tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+    using tensorwrapper::operations::approximately_equal;
+    REQUIRE(approximately_equal(corr, e, 1E-6));
+    REQUIRE(n_calls > 0);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../integration_tests.hpp"
+
+using rscf_wf     = simde::type::rscf_wf;
+using hamiltonian = simde::type::hamiltonian;
+using occ_index   = typename rscf_wf::orbital_index_set_type;
+using pt          = simde::InitialGuess<rscf_wf>;
+using egy_pt      = simde::eval_braket<rscf_wf, hamiltonian, rscf_wf>;
+using opt_pt      = simde::Optimize<egy_pt, rscf_wf>;
+
+using fragment_list = std::vector<std::vector<std::size_t>>;
+
+using tensorwrapper::operations::approximately_equal;
+
+TEST_CASE("Fragment") {
+    auto mm   = test_scf::load_modules<double>();
+    auto aos  = test_scf::h2_aos();
+    auto H    = test_scf::h2_hamiltonian();
+    auto& mod = mm.at("Fragment guess");
+
+    SECTION("One bonded fragment") {
+        // The only fragment is the whole molecule, so the guess is the SCF
+        auto psi = mod.run_as<pt>(H, aos);
+        REQUIRE(psi.orbital_indices() == occ_index{0});
+        REQUIRE(psi.orbitals().from_space() == aos);
+
+        chemist::braket::BraKet H_00(psi, H, psi);
+        const auto& [e, psi_scf] = mm.at("Loop").run_as<opt_pt>(H_00, psi);
+        const auto& evals        = psi.orbitals().diagonalized_matrix();
+        const auto& scf_evals    = psi_scf.orbitals().diagonalized_matrix();
+        REQUIRE(approximately_equal(scf_evals, evals, 1E-6));
+    }
+
+    SECTION("User-specified fragments") {
+        mod.change_input("fragments", fragment_list{{0}, {1}});
+
+        SECTION("Neutral atoms") {
+            auto psi = mod.run_as<pt>(H, aos);
+            REQUIRE(psi.orbital_indices() == occ_index{0});
+            REQUIRE(psi.orbitals().from_space() == aos);
+        }
+
+        SECTION("Purified") {
+            mod.change_input("purification steps", std::size_t{3});
+            auto psi = mod.run_as<pt>(H, aos);
+            REQUIRE(psi.orbital_indices() == occ_index{0});
+        }
+
+        SECTION("Charges") {
+            mod.change_input("fragment charges", std::vector<int>{1, -1});
+            auto psi = mod.run_as<pt>(H, aos);
+            REQUIRE(psi.orbital_indices() == occ_index{0});
+        }
+
+        SECTION("Charges of the wrong system") {
+            mod.change_input("fragment charges", std::vector<int>{1, 0});
+            REQUIRE_THROWS_AS(mod.run_as<pt>(H, aos), std::runtime_error);
+        }
+    }
+
+    SECTION("Not a partition") {
+        mod.change_input("fragments", fragment_list{{0}, {0, 1}});
+        REQUIRE_THROWS_AS(mod.run_as<pt>(H, aos), std::runtime_error);
+    }
+}
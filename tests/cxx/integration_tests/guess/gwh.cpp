@@ -0,0 +1,51 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../integration_tests.hpp"
+
+using rscf_wf   = simde::type::rscf_wf;
+using occ_index = typename rscf_wf::orbital_index_set_type;
+using pt        = simde::InitialGuess<rscf_wf>;
+using s_pt      = simde::aos_s_e_aos;
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("GWH") {
+    auto mm  = test_scf::load_modules<double>();
+    auto aos = test_scf::h2_aos();
+    auto H   = test_scf::h2_hamiltonian();
+
+    auto psi          = mm.at("GWH guess").run_as<pt>(H, aos);
+    const auto& evals = psi.orbitals().diagonalized_matrix();
+
+    REQUIRE(psi.orbital_indices() == occ_index{0});
+    REQUIRE(psi.orbitals().from_space() == aos);
+
+    // For H2 in a minimal basis the eigenvalues are (a +- b) / (1 +- s)
+    chemist::braket::BraKet s_mn(aos, simde::type::s_e_type{}, aos);
+    const auto S = mm.at("Overlap").run_as<s_pt>(s_mn);
+    using tensorwrapper::buffer::get_raw_data;
+    using tensorwrapper::buffer::make_contiguous;
+    const auto& s_buffer = make_contiguous(S.buffer());
+    const auto& e_buffer = make_contiguous(evals.buffer());
+    const auto s         = get_raw_data<double>(s_buffer)[1];
+    const auto e         = get_raw_data<double>(e_buffer);
+
+    const double a = -13.6 / 27.211386245988;
+    const double b = 1.75 * s * a;
+    REQUIRE_THAT(e[0], WithinAbs((a + b) / (1.0 + s), 1E-8));
+    REQUIRE_THAT(e[1], WithinAbs((a - b) / (1.0 - s), 1E-8));
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../integration_tests.hpp"
+
+using rscf_wf     = simde::type::rscf_wf;
+using hamiltonian = simde::type::hamiltonian;
+using occ_index   = typename rscf_wf::orbital_index_set_type;
+using pt          = simde::InitialGuess<rscf_wf>;
+using egy_pt      = simde::eval_braket<rscf_wf, hamiltonian, rscf_wf>;
+using opt_pt      = simde::Optimize<egy_pt, rscf_wf>;
+
+using tensorwrapper::operations::approximately_equal;
+
+TEST_CASE("Projection") {
+    auto mm  = test_scf::load_modules<double>();
+    auto aos = test_scf::h2_aos();
+    auto H   = test_scf::h2_hamiltonian();
+
+    auto psi = mm.at("Projection guess").run_as<pt>(H, aos);
+
+    REQUIRE(psi.orbital_indices() == occ_index{0});
+    REQUIRE(psi.orbitals().from_space() == aos);
+
+    // The target basis is the small basis (STO-3G), so projecting is exact
+    // and the guess is already the converged SCF
+    chemist::braket::BraKet H_00(psi, H, psi);
+    const auto& [e, psi_scf] = mm.at("Loop").run_as<opt_pt>(H_00, psi);
+
+    tensorwrapper::shape::Smooth shape_corr{};
+    auto pcorr = tensorwrapper::buffer::make_contiguous<double>(shape_corr);
+    pcorr.set_elem({}, -1.1167592336);
+    tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+    REQUIRE(approximately_equal(corr, e, 1E-6));
+
+    const auto& evals     = psi.orbitals().diagonalized_matrix();
+    const auto& scf_evals = psi_scf.orbitals().diagonalized_matrix();
+    REQUIRE(approximately_equal(scf_evals, evals, 1E-6));
+}
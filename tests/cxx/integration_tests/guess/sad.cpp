@@ -15,6 +15,9 @@
  */
 
 #include "../integration_tests.hpp"
+#include "guess/atomic_density_cache.hpp"
+#include "guess/guess_common.hpp"
+#include <filesystem>
 
 using simde::type::tensor;
 using shape_type   = tensorwrapper::shape::Smooth;
@@ -25,6 +28,8 @@ using occ_index    = typename rscf_wf::orbital_index_set_type;
 
 using pt             = simde::InitialGuess<rscf_wf>;
 using initial_rho_pt = simde::InitialDensity;
+using basis_pt       = simde::MolecularBasisSet;
+using ao_pt          = simde::aos_op_base_aos;
 
 using tensorwrapper::operations::approximately_equal;
 
@@ -37,7 +42,7 @@ TEMPLATE_LIST_TEST_CASE("SAD", "", types) {
     auto H   = test_scf::h2_hamiltonian();
     auto rt  = mm.get_runtime();
 
-    auto mod          = mm.at("SAD guess");
+    auto mod          = mm.at("Cached SAD guess");
     auto psi          = mod.template run_as<pt>(H, aos);
     const auto& evals = psi.orbitals().diagonalized_matrix();
 
@@ -51,3 +56,88 @@ TEMPLATE_LIST_TEST_CASE("SAD", "", types) {
     REQUIRE(psi.orbitals().from_space() == aos);
     REQUIRE(approximately_equal(corr, evals, 1E-6));
 }
+
+TEST_CASE("Cached SAD") {
+    auto mm  = test_scf::load_modules<double>();
+    auto aos = test_scf::h2_aos();
+    auto H   = test_scf::h2_hamiltonian();
+
+    auto& cache = scf::guess::AtomicDensityCache::instance();
+    cache.clear();
+
+    // H in STO-3G has one AO and half an electron pair
+    auto check_h_density = [&]() {
+        REQUIRE(cache.size() == 1);
+        const auto& h_bs  = aos.ao_basis_set()[0];
+        const auto h_hash = scf::guess::atomic_basis_hash(h_bs);
+        auto block        = cache.find({std::uint32_t(1), h_hash});
+        REQUIRE(block.has_value());
+        REQUIRE(block->size() == 1);
+        REQUIRE_THAT((*block)[0], Catch::Matchers::WithinAbs(0.5, 1E-8));
+    };
+
+    SECTION("In memory") {
+        auto psi = mm.at("Cached SAD guess").run_as<pt>(H, aos);
+        REQUIRE(psi.orbital_indices() == occ_index{0});
+        REQUIRE(psi.orbitals().from_space() == aos);
+        check_h_density();
+    }
+
+    SECTION("On disk") {
+        auto path = std::filesystem::temp_directory_path();
+        path /= "scf_sad_test.bin";
+        std::filesystem::remove(path);
+        mm.change_input("Cached SAD guess", "atomic density file",
+                        path.string());
+        mm.at("Cached SAD guess").run_as<pt>(H, aos);
+        REQUIRE(std::filesystem::exists(path));
+
+        cache.clear();
+        cache.load(path);
+        check_h_density();
+        std::filesystem::remove(path);
+    }
+
+    SECTION("Multi-shell atom") {
+        // Water in STO-3G: O carries 1s, 2s and 2p shells
+        auto o  = simde::type::nucleus("O", 8ul, 29156.95, 0.0, 0.0, 0.0);
+        auto h0 = test_scf::h_nucleus(0.0, 1.4305, 1.1093);
+        auto h1 = test_scf::h_nucleus(0.0, -1.4305, 1.1093);
+        simde::type::nuclei water{o, h0, h1};
+        simde::type::molecule mol(0, 1, water);
+        simde::type::aos h2o_aos(mm.at("STO-3G").run_as<basis_pt>(mol));
+
+        simde::type::many_electrons es(10);
+        simde::type::T_e_type T_e(es);
+        simde::type::V_en_type V_en(es, water);
+        simde::type::V_ee_type V_ee(es, es);
+        simde::type::V_nn_type V_nn(water, water);
+        simde::type::hamiltonian H_h2o(T_e + V_en + V_ee + V_nn);
+
+        auto psi = mm.at("Cached SAD guess").run_as<pt>(H_h2o, h2o_aos);
+        REQUIRE(psi.orbital_indices() == occ_index{0, 1, 2, 3, 4});
+
+        // One entry for O, one shared by both H
+        REQUIRE(cache.size() == 2);
+        const auto& o_bs  = h2o_aos.ao_basis_set()[0];
+        const auto o_hash = scf::guess::atomic_basis_hash(o_bs);
+        auto block        = cache.find({std::uint32_t(8), o_hash});
+        REQUIRE(block.has_value());
+        REQUIRE(block->size() == 25);
+
+        // The O block holds four electron pairs in the atom's own metric
+        using braket_type =
+          simde::type::braket<simde::type::aos, simde::type::op_base_type,
+                              simde::type::aos>;
+        braket_type s_mn(h2o_aos, simde::type::s_e_type{}, h2o_aos);
+        auto S = scf::guess::to_doubles(
+          mm.at("SCF integral driver").run_as<ao_pt>(s_mn));
+        const std::size_t n = 7;
+        double tr           = 0.0;
+        for(std::size_t i = 0; i < 5; ++i)
+            for(std::size_t j = 0; j < 5; ++j)
+                tr += (*block)[i * 5 + j] * S[i * n + j];
+        REQUIRE_THAT(tr, Catch::Matchers::WithinAbs(4.0, 1E-8));
+    }
+    cache.clear();
+}
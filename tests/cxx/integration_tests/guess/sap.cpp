@@ -0,0 +1,59 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../integration_tests.hpp"
+
+using rscf_wf   = simde::type::rscf_wf;
+using occ_index = typename rscf_wf::orbital_index_set_type;
+using pt        = simde::InitialGuess<rscf_wf>;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("SAP") {
+    auto mm  = test_scf::load_modules<double>();
+    auto aos = test_scf::h2_aos();
+    auto H   = test_scf::h2_hamiltonian();
+
+    using tensorwrapper::buffer::get_raw_data;
+    using tensorwrapper::buffer::make_contiguous;
+    auto orbital_energies = [&](const std::string& key) {
+        auto psi = mm.at(key).run_as<pt>(H, aos);
+        REQUIRE(psi.orbital_indices() == occ_index{0});
+        REQUIRE(psi.orbitals().from_space() == aos);
+        const auto& evals  = psi.orbitals().diagonalized_matrix();
+        const auto& buffer = make_contiguous(evals.buffer());
+        const auto e       = get_raw_data<double>(buffer);
+        return std::vector<double>(e.begin(), e.end());
+    };
+
+    const auto e      = orbital_energies("SAP guess");
+    const auto e_core = orbital_energies("Core guess");
+
+    // Bonding orbital below antibonding, and bound
+    REQUIRE(e[0] < e[1]);
+    REQUIRE(e[0] < 0.0);
+
+    // V_SAP is the core potential screened by the atoms' own electrons, so
+    // every orbital energy lies well above the core guess' one
+    REQUIRE(e[0] > e_core[0] + 0.5);
+    REQUIRE(e[1] > e_core[1] + 0.5);
+
+    SECTION("Screening only drops negligible contributions") {
+        mm.change_input("SAP guess", "screening threshold", 0.0);
+        const auto e_all = orbital_energies("SAP guess");
+        REQUIRE_THAT(e[0], WithinAbs(e_all[0], 1.0E-6));
+        REQUIRE_THAT(e[1], WithinAbs(e_all[1], 1.0E-6));
+    }
+}
@@ -59,10 +59,21 @@ pluginplay::ModuleManager load_modules() {
 
     mm.change_submod("Diagonalization Fock update", "Overlap matrix builder",
                      "Overlap");
+    mm.change_submod("GDM Fock update", "Overlap matrix builder", "Overlap");
 
     mm.change_submod("Loop", "Overlap matrix builder", "Overlap");
 
+#ifndef BUILD_TAMM_SCF
+    mm.change_submod("Cholesky J and K", "ERI4", "ERI4");
+    mm.change_submod("Conventional J and K", "ERI4", "ERI4");
+#endif
+    mm.change_submod("RI factors", "ERI2", "ERI2");
+    mm.change_submod("RI factors", "ERI3", "ERI3");
+
     mm.change_submod("SAD guess", "SAD Density", "sto-3g SAD density");
+    mm.change_submod("Cached SAD guess", "ERI4", "ERI4");
+    mm.change_submod("Projection guess", "Small basis set", "STO-3G");
+    mm.change_submod("Fragment guess", "ERI4", "ERI4");
 
     if constexpr(std::is_same_v<FloatType, tensorwrapper::types::udouble>) {
         configure_uq(mm, "uncertain");
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef BUILD_TAMM_SCF
+#include "../integration_tests.hpp"
+#include "jk/jk_property_types.hpp"
+
+namespace {
+
+// A chain of n He atoms spaced dz apart along z, with a density which
+// couples neighboring atoms
+auto he_chain(std::size_t n, double dz) {
+    simde::type::nuclei nuclei;
+    for(std::size_t i = 0; i < n; ++i)
+        nuclei.push_back(test_scf::he_nucleus(0.0, 0.0, i * dz));
+    simde::type::aos aos(test_scf::he_basis(nuclei));
+
+    std::vector<double> P(n * n, 0.0);
+    std::vector<double> C(n * n, 0.0);
+    for(std::size_t i = 0; i < n; ++i) {
+        P[i * n + i] = 1.0;
+        C[i * n + i] = 1.0;
+        if(i + 1 < n) P[i * n + i + 1] = P[(i + 1) * n + i] = 0.1;
+    }
+    using tensorwrapper::utilities::make_tensor;
+    simde::type::mos mos(aos, make_tensor({n, n}, C));
+    simde::type::decomposable_e_density rho(make_tensor({n, n}, P), mos);
+    return std::make_pair(aos, rho);
+}
+
+} // namespace
+
+TEST_CASE("CFMMJ") {
+    using pt  = simde::aos_j_e_aos;
+    auto mm   = test_scf::load_modules<double>();
+    auto& mod = mm.at("CFMM J");
+    simde::type::electron e;
+
+    // Atoms 6 bohr apart and one pair per leaf, so that most atom pairs
+    // interact through multipoles
+    auto [aos, rho] = he_chain(8, 6.0);
+    simde::type::j_e_type j_e(e, rho);
+    chemist::braket::BraKet j_mn(aos, j_e, aos);
+
+    // The conventional (stored ERI) build is the reference
+    using jk_pt        = scf::jk::JKDriver;
+    auto& conventional = mm.at("Conventional J and K");
+    const auto& [J_corr, K_corr] =
+      conventional.run_as<jk_pt>(aos, rho.value());
+    mod.change_input("leaf size", std::size_t{1});
+
+    using tensorwrapper::operations::approximately_equal;
+
+    SECTION("default opening angle") {
+        const auto& J = mod.run_as<pt>(j_mn);
+        REQUIRE(approximately_equal(J, J_corr, 1E-6));
+
+        // The cached setup gives the same J for the same inputs
+        const auto& J2 = mod.run_as<pt>(j_mn);
+        REQUIRE(approximately_equal(J2, J, 1E-14));
+    }
+
+    SECTION("wide opening angle, one and all threads") {
+        mod.change_input("opening angle", 0.5);
+        for(std::size_t max_threads : {1, 0}) {
+            mod.change_input("max threads", max_threads);
+            const auto& J = mod.run_as<pt>(j_mn);
+            REQUIRE(approximately_equal(J, J_corr, 1E-4));
+        }
+    }
+
+    SECTION("monopoles only") {
+        mod.change_input("multipole order", std::size_t{0});
+        const auto& J = mod.run_as<pt>(j_mn);
+        REQUIRE(approximately_equal(J, J_corr, 1E-3));
+    }
+}
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../integration_tests.hpp"
+#include "jk/jk_property_types.hpp"
+
+using pt = scf::jk::JKDriver;
+
+TEST_CASE("CholeskyJK") {
+    auto mm   = test_scf::load_modules<double>();
+    auto aos  = test_scf::h2_aos();
+    auto& mod = mm.at("Cholesky J and K");
+    simde::type::electron e;
+    auto rho = test_scf::h2_density<double>();
+
+    using tensorwrapper::operations::approximately_equal;
+
+    simde::type::j_e_type j_e(e, rho);
+    chemist::braket::BraKet j_mn(aos, j_e, aos);
+    auto& jmod         = mm.at("Four center J builder");
+    const auto& J_corr = jmod.run_as<simde::aos_j_e_aos>(j_mn);
+
+    simde::type::k_e_type k_e(e, rho);
+    chemist::braket::BraKet k_mn(aos, k_e, aos);
+    auto& kmod         = mm.at("Four center K builder");
+    const auto& K_corr = kmod.run_as<simde::aos_k_e_aos>(k_mn);
+
+    mod.change_input("Cholesky threshold", 1.0E-10);
+
+    SECTION("In memory") {
+        const auto& [J, K] = mod.run_as<pt>(aos, rho.value());
+        REQUIRE(approximately_equal(J, J_corr, 1E-6));
+        REQUIRE(approximately_equal(K, K_corr, 1E-6));
+    }
+
+    SECTION("Memory mapped") {
+        mod.change_input("memory map", true);
+        const auto& [J, K] = mod.run_as<pt>(aos, rho.value());
+        REQUIRE(approximately_equal(J, J_corr, 1E-6));
+        REQUIRE(approximately_equal(K, K_corr, 1E-6));
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../integration_tests.hpp"
+#include "jk/jk_property_types.hpp"
+
+using pt = scf::jk::JKDriver;
+
+TEST_CASE("ConventionalJK") {
+    auto mm   = test_scf::load_modules<double>();
+    auto aos  = test_scf::h2_aos();
+    auto& mod = mm.at("Conventional J and K");
+    simde::type::electron e;
+    auto rho = test_scf::h2_density<double>();
+
+    using tensorwrapper::operations::approximately_equal;
+
+    simde::type::j_e_type j_e(e, rho);
+    chemist::braket::BraKet j_mn(aos, j_e, aos);
+    auto& jmod         = mm.at("Four center J builder");
+    const auto& J_corr = jmod.run_as<simde::aos_j_e_aos>(j_mn);
+
+    simde::type::k_e_type k_e(e, rho);
+    chemist::braket::BraKet k_mn(aos, k_e, aos);
+    auto& kmod         = mm.at("Four center K builder");
+    const auto& K_corr = kmod.run_as<simde::aos_k_e_aos>(k_mn);
+
+    SECTION("In memory") {
+        const auto& [J, K] = mod.run_as<pt>(aos, rho.value());
+        REQUIRE(approximately_equal(J, J_corr, 1E-10));
+        REQUIRE(approximately_equal(K, K_corr, 1E-10));
+    }
+
+    SECTION("Memory mapped") {
+        mod.change_input("memory budget", std::size_t{0});
+        const auto& [J, K] = mod.run_as<pt>(aos, rho.value());
+        REQUIRE(approximately_equal(J, J_corr, 1E-10));
+        REQUIRE(approximately_equal(K, K_corr, 1E-10));
+    }
+
+#ifdef BUILD_TAMM_SCF
+    SECTION("Via the SCF integrals driver") {
+        using erased_type =
+          chemist::braket::BraKet<simde::type::aos, simde::type::op_base_type,
+                                  simde::type::aos>;
+        using driver_pt = simde::aos_op_base_aos;
+        auto& driver    = mm.at("SCF integral driver");
+        driver.change_input("conventional", true);
+        const auto& J = driver.run_as<driver_pt>(erased_type(j_mn));
+        const auto& K = driver.run_as<driver_pt>(erased_type(k_mn));
+        REQUIRE(approximately_equal(J, J_corr, 1E-10));
+        REQUIRE(approximately_equal(K, K_corr, 1E-10));
+    }
+#endif
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef BUILD_TAMM_SCF
+#include "../integration_tests.hpp"
+#include "jk/jk_property_types.hpp"
+
+using pt = scf::jk::JKDriver;
+
+TEST_CASE("DirectJK") {
+    auto mm   = test_scf::load_modules<double>();
+    auto aos  = test_scf::h2_aos();
+    auto& mod = mm.at("Direct J and K");
+    auto rho  = test_scf::h2_density<double>();
+
+    using tensorwrapper::operations::approximately_equal;
+
+    // The conventional (stored ERI) build is the reference
+    auto& conventional = mm.at("Conventional J and K");
+    const auto& [J_corr, K_corr] = conventional.run_as<pt>(aos, rho.value());
+
+    SECTION("All quartets") {
+        mod.change_input("screening threshold", 0.0);
+        const auto& [J, K] = mod.run_as<pt>(aos, rho.value());
+        REQUIRE(approximately_equal(J, J_corr, 1E-10));
+        REQUIRE(approximately_equal(K, K_corr, 1E-10));
+    }
+
+    SECTION("Screened, one and all threads") {
+        for(std::size_t max_threads : {1, 0}) {
+            mod.change_input("max threads", max_threads);
+            const auto& [J, K] = mod.run_as<pt>(aos, rho.value());
+            REQUIRE(approximately_equal(J, J_corr, 1E-8));
+            REQUIRE(approximately_equal(K, K_corr, 1E-8));
+        }
+    }
+
+    SECTION("Default J and K of the SCF integral driver") {
+        using op_pt = simde::aos_op_base_aos;
+        using op_t  = simde::type::op_base_type;
+        simde::type::electron e;
+        auto& driver = mm.at("SCF integral driver");
+
+        simde::type::j_e_type j_e(e, rho);
+        chemist::braket::BraKet j_mn(aos, static_cast<const op_t&>(j_e), aos);
+        const auto& J = driver.run_as<op_pt>(j_mn);
+        REQUIRE(approximately_equal(J, J_corr, 1E-8));
+
+        simde::type::k_e_type k_e(e, rho);
+        chemist::braket::BraKet k_mn(aos, static_cast<const op_t&>(k_e), aos);
+        const auto& K = driver.run_as<op_pt>(k_mn);
+        REQUIRE(approximately_equal(K, K_corr, 1E-8));
+    }
+
+    SECTION("Schwarz factors") {
+        auto& q_mod   = mm.at("Schwarz factors");
+        const auto& Q = q_mod.run_as<scf::jk::SchwarzFactors>(aos);
+        using tensorwrapper::buffer::make_contiguous;
+        const auto& Q_buffer = make_contiguous(Q.buffer());
+        auto data = tensorwrapper::buffer::get_raw_data<double>(Q_buffer);
+        REQUIRE(data.size() == 4);
+        REQUIRE(data[1] == Catch::Approx(data[2]));
+        for(auto q : data) REQUIRE(q > 0.0);
+    }
+}
+#endif
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../integration_tests.hpp"
+
+namespace {
+
+// Uncontracted s functions whose exponents are all pairwise sums of the
+// STO-3G He exponents, so the auxiliary basis spans the He orbital products
+// exactly and density fitting is exact.
+auto he_product_basis() {
+    using ao_basis_type            = chemist::basis_set::AOBasisSetD;
+    using atomic_basis_type        = typename ao_basis_type::value_type;
+    using shell_type               = typename atomic_basis_type::value_type;
+    using contracted_gaussian_type = typename shell_type::cg_type;
+    using center_type = typename atomic_basis_type::shell_traits::center_type;
+
+    std::vector<double> he_exps{6.3624213940e+00, 1.1589229990e+00,
+                                3.1364979150e-01};
+    auto he = test_scf::make_he<simde::type::nuclei>();
+    center_type coords(he[0].x(), he[0].y(), he[0].z());
+    auto pure = shell_type::pure_type::pure;
+    shell_type::angular_momentum_type l0{0};
+
+    atomic_basis_type aux("He products", 2, coords);
+    for(std::size_t i = 0; i < he_exps.size(); ++i) {
+        for(std::size_t j = 0; j <= i; ++j) {
+            std::vector<double> coef{1.0};
+            std::vector<double> exp{he_exps[i] + he_exps[j]};
+            contracted_gaussian_type cg(coef.begin(), coef.end(), exp.begin(),
+                                        exp.end(), coords);
+            aux.add_shell(pure, l0, cg);
+        }
+    }
+    ao_basis_type rv;
+    rv.add_center(aux);
+    return simde::type::aos(rv);
+}
+
+} // namespace
+
+TEST_CASE("RI-J and RI-K") {
+    auto mm  = test_scf::load_modules<double>();
+    auto aos = test_scf::he_aos();
+    auto aux = he_product_basis();
+    simde::type::electron e;
+    auto rho = test_scf::he_density<double>();
+
+    using tensorwrapper::operations::approximately_equal;
+
+    SECTION("RI-J") {
+        auto& mod = mm.at("RI-J");
+        simde::type::j_e_type j_e(e, rho);
+        chemist::braket::BraKet j_mn(aos, j_e, aos);
+
+        REQUIRE_THROWS_AS(mod.run_as<simde::aos_j_e_aos>(j_mn),
+                          std::runtime_error);
+
+        mod.change_input("auxiliary basis", aux);
+        const auto& J  = mod.run_as<simde::aos_j_e_aos>(j_mn);
+        auto& jmod     = mm.at("Four center J builder");
+        const auto& J0 = jmod.run_as<simde::aos_j_e_aos>(j_mn);
+        REQUIRE(approximately_equal(J, J0, 1E-6));
+    }
+
+    SECTION("RI-K") {
+        auto& mod = mm.at("RI-K");
+        simde::type::k_e_type k_e(e, rho);
+        chemist::braket::BraKet k_mn(aos, k_e, aos);
+
+        mod.change_input("auxiliary basis", aux);
+        const auto& K  = mod.run_as<simde::aos_k_e_aos>(k_mn);
+        auto& kmod     = mm.at("Four center K builder");
+        const auto& K0 = kmod.run_as<simde::aos_k_e_aos>(k_mn);
+        REQUIRE(approximately_equal(K, K0, 1E-6));
+    }
+}
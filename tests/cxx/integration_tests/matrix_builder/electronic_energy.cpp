@@ -68,4 +68,26 @@ TEMPLATE_LIST_TEST_CASE("ElectronicEnergy", "", test_scf::float_types) {
             REQUIRE(approximately_equal(corr, E_elec, 1E-5));
         }
     }
+    SECTION("Hybrid RKS") {
+        if constexpr(std::is_same_v<float_type, double>) {
+            // Stands in for sn-LinK and counts how often it is asked for K
+            std::size_t n_calls = 0;
+            simde::type::tensor K_sn{{1.0, 2.0}, {2.0, 1.0}};
+            auto k_mod = pluginplay::make_lambda<simde::aos_k_e_aos>(
+              [&](auto&&) {
+                  ++n_calls;
+                  return K_sn;
+              });
+            mod.change_submod("Hybrid exchange matrix", k_mod);
+
+            auto func = chemist::qm_operator::xc_functional::PBE0;
+            simde::type::XC_e_type XC_e(func, es, rho);
+            simde::type::K_e_type K_e(es, rho);
+            simde::type::electronic_hamiltonian H_e(
+              T_e * 2.0 + V_en * 2.0 + J_e * 2.0 + XC_e - K_e * 0.25);
+            chemist::braket::BraKet braket(psi, H_e, psi);
+            mod.template run_as<pt<wf_type>>(braket);
+            REQUIRE(n_calls == 1);
+        }
+    }
 }
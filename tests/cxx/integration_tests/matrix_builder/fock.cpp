@@ -66,4 +66,71 @@ TEMPLATE_LIST_TEST_CASE("Fock Matrix Builder", "", test_scf::float_types) {
 
         REQUIRE(approximately_equal(F, corr, 1E-6));
     }
+
+    SECTION("Concurrent terms") {
+        mod.change_input("concurrent terms", true);
+        auto f_e = test_scf::h2_fock<simde::type::electron, float_type>();
+        chemist::braket::BraKet f_mn(aos, f_e, aos);
+        const auto& F = mod.template run_as<pt>(f_mn);
+
+        pcorr.set_elem({0, 0}, float_type{-0.319459});
+        pcorr.set_elem({0, 1}, float_type{-0.571781});
+        pcorr.set_elem({1, 0}, float_type{-0.571781});
+        pcorr.set_elem({1, 1}, float_type{-0.319459});
+
+        tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+
+        REQUIRE(approximately_equal(F, corr, 1E-6));
+    }
+    SECTION("Hybrid exchange") {
+        if constexpr(std::is_same_v<float_type, double>) {
+            simde::type::electron e;
+            auto rho  = test_scf::h2_density<double>();
+            auto func = chemist::qm_operator::xc_functional::PBE0;
+            using k_type  = simde::type::k_e_type;
+            using xc_type = simde::type::xc_e_type;
+
+            // Stands in for sn-LinK and counts how often it is asked for K
+            std::size_t n_calls = 0;
+            simde::type::tensor K_sn{{1.0, 2.0}, {2.0, 1.0}};
+            auto k_mod = pluginplay::make_lambda<simde::aos_k_e_aos>(
+              [&](auto&&) {
+                  ++n_calls;
+                  return K_sn;
+              });
+            mod.change_submod("Hybrid exchange matrix", k_mod);
+
+            // T - 0.25K, plus XC for the hybrid functional
+            auto make_f = [&](bool with_xc) {
+                simde::type::fock f;
+                f.emplace_back(1.0, std::make_unique<t_e_type>(e));
+                f.emplace_back(-0.25, std::make_unique<k_type>(e, rho));
+                if(with_xc)
+                    f.emplace_back(1.0,
+                                   std::make_unique<xc_type>(func, e, rho));
+                return f;
+            };
+            auto f_e      = make_f(false);
+            auto f_hybrid = make_f(true);
+
+            SECTION("hybrid functional") {
+                chemist::braket::BraKet f_mn(aos, f_hybrid, aos);
+                mod.template run_as<pt>(f_mn);
+                REQUIRE(n_calls == 1);
+            }
+
+            SECTION("no XC term") {
+                chemist::braket::BraKet f_mn(aos, f_e, aos);
+                mod.template run_as<pt>(f_mn);
+                REQUIRE(n_calls == 0);
+            }
+
+            SECTION("turned off") {
+                mod.change_input("seminumerical hybrid exchange", false);
+                chemist::braket::BraKet f_mn(aos, f_hybrid, aos);
+                mod.template run_as<pt>(f_mn);
+                REQUIRE(n_calls == 0);
+            }
+        }
+    }
 }
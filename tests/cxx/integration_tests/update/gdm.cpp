@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../integration_tests.hpp"
+#include "update/gdm.hpp"
+#include <cmath>
+
+using wf_t              = simde::type::rscf_wf;
+using pt                = simde::UpdateGuess<wf_t>;
+using orbital_index_set = typename wf_t::orbital_index_set_type;
+using cmos_t            = simde::type::cmos;
+using density_t         = simde::type::decomposable_e_density;
+using density_pt        = simde::aos_rho_e_aos<cmos_t>;
+using fock_pt           = simde::FockOperator<density_t>;
+
+using simde::type::t_e_type;
+using simde::type::tensor;
+using simde::type::v_en_type;
+using tensorwrapper::operations::approximately_equal;
+
+TEST_CASE("GDM") {
+    auto mm   = test_scf::load_modules<double>();
+    auto& mod = mm.at("GDM Fock update");
+
+    auto aos = test_scf::h2_aos();
+    auto h2  = test_scf::make_h2<simde::type::nuclei>();
+    simde::type::electron e;
+    orbital_index_set occs{0};
+
+    SECTION("No old guess") {
+        simde::type::fock f_e;
+        f_e.emplace_back(1.0, std::make_unique<t_e_type>(e));
+        f_e.emplace_back(1.0, std::make_unique<v_en_type>(e, h2));
+
+        simde::type::tensor empty;
+        cmos_t cmos(empty, aos, empty);
+        wf_t core_guess(occs, cmos);
+
+        const auto& psi = mod.run_as<pt>(f_e, core_guess);
+        REQUIRE(psi.orbital_indices() == occs);
+        REQUIRE(psi.orbitals().from_space() == aos);
+
+        const auto& evals = psi.orbitals().diagonalized_matrix();
+        const auto& corr  = test_scf::h2_cmos<double>().diagonalized_matrix();
+        REQUIRE(approximately_equal(evals, corr, 1E-6));
+    }
+
+    SECTION("Rotates back to the SCF orbitals") {
+        auto H = test_scf::h2_hamiltonian();
+
+        auto density = [&](const wf_t& psi) {
+            simde::type::rho_e<cmos_t> rho_hat(psi.orbitals(),
+                                               psi.occupations());
+            chemist::braket::BraKet P_mn(aos, rho_hat, aos);
+            auto& P_mod = mm.at("Density matrix builder");
+            return density_t(P_mod.run_as<density_pt>(P_mn), psi.orbitals());
+        };
+
+        // In a minimal basis the SCF orbitals of H2 are fixed by symmetry;
+        // start from them rotated by 0.3 rad
+        const auto cmos0 = test_scf::h2_cmos<double>();
+        using tensorwrapper::buffer::get_raw_data;
+        using tensorwrapper::buffer::make_contiguous;
+        const auto& c_buffer = make_contiguous(cmos0.transform().buffer());
+        const auto c0        = get_raw_data<double>(c_buffer);
+        const double cs = std::cos(0.3), sn = std::sin(0.3);
+        std::vector<double> c(4);
+        for(std::size_t mu = 0; mu < 2; ++mu) {
+            c[mu * 2 + 0] = cs * c0[mu * 2 + 0] + sn * c0[mu * 2 + 1];
+            c[mu * 2 + 1] = -sn * c0[mu * 2 + 0] + cs * c0[mu * 2 + 1];
+        }
+        using tensorwrapper::utilities::make_tensor;
+        cmos_t cmos(cmos0.diagonalized_matrix(), aos, make_tensor({2, 2}, c));
+        wf_t psi(occs, cmos);
+
+        // Each update gets the BFGS history of the previous one, as in the
+        // SCF loop
+        tensor history;
+        auto& fock_mod = mm.at("Restricted One-Electron Fock Op");
+        for(int iter = 0; iter < 30; ++iter) {
+            const auto& f = fock_mod.run_as<fock_pt>(H, density(psi));
+            auto inputs   = pt::wrap_inputs(mod.inputs(), f, psi);
+            inputs.at("update history").change(history);
+            auto results = mod.run(inputs);
+            history      = results.at("update history").value<tensor>();
+            psi          = std::get<0>(pt::unwrap_results(results));
+        }
+        REQUIRE(psi.orbital_indices() == occs);
+        REQUIRE(history != tensor{});
+
+        const auto P_corr = density(wf_t(occs, cmos0)).value();
+        REQUIRE(approximately_equal(density(psi).value(), P_corr, 1E-6));
+    }
+}
@@ -16,6 +16,7 @@
 
 #include "../test_scf.hpp"
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
 #include <scf/scf.hpp>
 #include <simde/simde.hpp>
 
@@ -69,4 +70,168 @@ TEST_CASE("CoulombsLaw") {
         tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
         REQUIRE(approximately_equal(corr, e, 1E-6));
     }
+
+    SECTION("large set w/ itself, on several threads") {
+        // Enough charges for several vector lanes and threads
+        simde::type::charges many;
+        double corr_e = 0.0;
+        for(std::size_t i = 0; i < 50; ++i) {
+            const double qi = (i % 2 ? 1.0 : -0.5);
+            charge_type q(qi, 0.1 * i, std::sin(double(i)), 0.3 * (i % 7));
+            for(const auto&& qj : many) {
+                auto dx = q.x() - qj.x();
+                auto dy = q.y() - qj.y();
+                auto dz = q.z() - qj.z();
+                auto r  = std::sqrt(dx * dx + dy * dy + dz * dz);
+                corr_e += qi * qj.charge() / r;
+            }
+            many.push_back(q);
+        }
+        mod.change_input("max threads", std::size_t{3});
+        auto e = mod.run_as<pt>(many, many);
+        pcorr.set_elem({}, corr_e);
+        tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+        REQUIRE(approximately_equal(corr, e, 1E-10));
+    }
+
+    SECTION("cutoff beyond every pair") {
+        mod.change_input("cutoff", 10.0);
+        auto e = mod.run_as<pt>(qs, qs);
+        pcorr.set_elem({}, -1.0103629710818451);
+        tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+        REQUIRE(approximately_equal(corr, e, 1E-6));
+    }
+
+    SECTION("cutoff between pairs") {
+        // q0-q1 and q1-q2 are sqrt(3) apart, q0-q2 twice that
+        mod.change_input("cutoff", 2.0);
+
+        SECTION("truncated") {
+            auto e = mod.run_as<pt>(qs, qs);
+            pcorr.set_elem({}, -1.4433756729740645);
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-6));
+        }
+
+        SECTION("damped shifted force") {
+            mod.change_input("far field", std::string("damped shifted force"));
+            auto e = mod.run_as<pt>(qs, qs);
+            pcorr.set_elem({}, -0.026317181872593347);
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-6));
+        }
+
+        SECTION("damped shifted force with the self term") {
+            mod.change_input("far field", std::string("damped shifted force"));
+            mod.change_input("self energy", true);
+            auto e = mod.run_as<pt>(qs, qs);
+            // Pair sum -0.026317181872593347 plus the self term
+            pcorr.set_elem({}, -1.1132114506511008);
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-6));
+        }
+
+        SECTION("different charges") {
+            simde::type::charges qs0{q0};
+            simde::type::charges qs12{q1, q2};
+            auto e = mod.run_as<pt>(qs0, qs12);
+            pcorr.set_elem({}, -1.0 / std::sqrt(3.0));
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-6));
+        }
+    }
+
+    SECTION("many charges over several cells per axis") {
+        // 216 charges on a jittered 6x6x6 lattice with spacing 2; with a
+        // cutoff of 3 the cell list has 3 cells along each axis
+        simde::type::charges many, others;
+        for(std::size_t i = 0; i < 216; ++i) {
+            const double x  = 2.0 * (i % 6) + 0.3 * std::sin(1.0 * i);
+            const double y  = 2.0 * ((i / 6) % 6) + 0.3 * std::cos(2.0 * i);
+            const double z  = 2.0 * (i / 36) + 0.3 * std::sin(3.0 * i);
+            const double qi = (i % 2 ? 1.0 : -1.0) * (1.0 + 0.1 * (i % 5));
+            many.push_back(charge_type(qi, x, y, z));
+            if(i % 3 == 0)
+                others.push_back(charge_type(-qi, x + 0.5, y + 0.5, z + 0.5));
+        }
+
+        const double rc = 3.0, alpha = 0.2;
+        const double erfc_rc = std::erfc(alpha * rc);
+        const double self = erfc_rc / (2.0 * rc) + alpha / std::sqrt(M_PI);
+        const double force =
+          erfc_rc / (rc * rc) +
+          2.0 * alpha / std::sqrt(M_PI) * std::exp(-alpha * alpha * rc * rc) /
+            rc;
+        auto v = [&](double r, bool dsf) {
+            if(!dsf) return 1.0 / r;
+            return std::erfc(alpha * r) / r - erfc_rc / rc + force * (r - rc);
+        };
+        // Brute force over all pairs (j < i for identical sets)
+        auto reference = [&](const simde::type::charges& a,
+                             const simde::type::charges& b, bool dsf,
+                             bool with_self = false) {
+            const bool same = &a == &b;
+            double e        = 0.0;
+            std::size_t i   = 0;
+            for(const auto&& qi : a) {
+                std::size_t j = 0;
+                for(const auto&& qj : b) {
+                    if(same && j == i) break;
+                    ++j;
+                    const auto dx = qi.x() - qj.x();
+                    const auto dy = qi.y() - qj.y();
+                    const auto dz = qi.z() - qj.z();
+                    const auto r  = std::sqrt(dx * dx + dy * dy + dz * dz);
+                    if(r < rc) e += qi.charge() * qj.charge() * v(r, dsf);
+                }
+                if(same && with_self) e -= self * qi.charge() * qi.charge();
+                ++i;
+            }
+            return e;
+        };
+
+        mod.change_input("cutoff", rc);
+        mod.change_input("damping", alpha);
+        mod.change_input("max threads", std::size_t{4});
+
+        SECTION("truncated") {
+            auto e = mod.run_as<pt>(many, many);
+            pcorr.set_elem({}, reference(many, many, false));
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-9));
+        }
+
+        SECTION("damped shifted force") {
+            mod.change_input("far field", std::string("damped shifted force"));
+            auto e = mod.run_as<pt>(many, many);
+            pcorr.set_elem({}, reference(many, many, true));
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-9));
+        }
+
+        SECTION("damped shifted force with the self term") {
+            mod.change_input("far field", std::string("damped shifted force"));
+            mod.change_input("self energy", true);
+            auto e = mod.run_as<pt>(many, many);
+            pcorr.set_elem({}, reference(many, many, true, true));
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-9));
+        }
+
+        SECTION("damped shifted force, different charges") {
+            // No self term between disjoint sets
+            mod.change_input("far field", std::string("damped shifted force"));
+            mod.change_input("self energy", true);
+            auto e = mod.run_as<pt>(many, others);
+            pcorr.set_elem({}, reference(many, others, true));
+            tensorwrapper::Tensor corr(shape_corr, std::move(pcorr));
+            REQUIRE(approximately_equal(corr, e, 1E-9));
+        }
+    }
+
+    SECTION("unknown far field") {
+        mod.change_input("cutoff", 2.0);
+        mod.change_input("far field", std::string("multipoles"));
+        REQUIRE_THROWS_AS(mod.run_as<pt>(qs, qs), std::runtime_error);
+    }
 }
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "driver/block_sparse_gradient.hpp"
+#include <scf/driver/commutator.hpp>
+
+using scf::driver::BlockSparseGradient;
+
+TEST_CASE("BlockSparseGradient") {
+    simde::type::tensor F{{1.0, 2.0}, {3.0, 4.0}};
+    simde::type::tensor P{{2.0, 3.0}, {4.0, 5.0}};
+    simde::type::tensor S{{3.0, 4.0}, {5.0, 6.0}};
+    simde::type::tensor corr{{-14, -42}, {42, 14}};
+    const std::vector<std::size_t> offsets{0, 1, 2};
+
+    REQUIRE(BlockSparseGradient::supports(S));
+    BlockSparseGradient grad(S, offsets, 1.0E-12);
+
+    SECTION("needs a density") { REQUIRE_THROWS(grad.compute(F)); }
+
+    SECTION("gradient and its norm") {
+        grad.set_density(P);
+        // tr(GG) = 2 * 14^2 - 2 * 42^2
+        REQUIRE(grad.compute(F) == Catch::Approx(-3136.0));
+        REQUIRE(grad.dense_gradient() == corr);
+        REQUIRE(grad.dense_gradient() == scf::driver::commutator(F, P, S));
+    }
+
+    SECTION("mismatched tiling") {
+        const std::vector<std::size_t> wrong{0, 1};
+        REQUIRE_THROWS(BlockSparseGradient(S, wrong, 1.0E-12));
+    }
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "eigen_solver/eigen_solver_property_types.hpp"
+#include "test_eigen_solver.hpp"
+
+using types = std::tuple<float, double>;
+using namespace test_eigen_solver;
+using namespace tensorwrapper::generate;
+
+namespace {
+
+// Copies the block starting at offset out of a packed result tensor
+template<typename FloatType>
+auto unpack(const simde::type::tensor& packed, std::size_t offset,
+            std::vector<std::size_t> shape) {
+    using tensorwrapper::buffer::get_raw_data;
+    using tensorwrapper::buffer::make_contiguous;
+    const auto& buffer = make_contiguous(packed.buffer());
+    auto data          = get_raw_data<FloatType>(buffer);
+    std::size_t size   = 1;
+    for(auto extent : shape) size *= extent;
+    std::vector<FloatType> block(data.begin() + offset,
+                                 data.begin() + offset + size);
+    if(shape.size() == 1) {
+        return tensorwrapper::utilities::make_tensor({shape[0]}, block);
+    }
+    return tensorwrapper::utilities::make_tensor({shape[0], shape[1]}, block);
+}
+
+// The n by n second-difference matrix, tridiag(-1, 2, -1). Its eigenvalues
+// are 2 - 2cos(k pi / (n + 1)), k = 1, ..., n, for any n.
+template<typename FloatType>
+EigenSystem second_difference(std::size_t n) {
+    using tensorwrapper::utilities::make_tensor;
+    std::vector<FloatType> mat(n * n, FloatType(0));
+    std::vector<FloatType> evals(n);
+    const double pi = std::acos(-1.0);
+    for(std::size_t i = 0; i < n; ++i) {
+        mat[i * n + i] = FloatType(2);
+        if(i + 1 < n) {
+            mat[i * n + i + 1]   = FloatType(-1);
+            mat[(i + 1) * n + i] = FloatType(-1);
+        }
+        evals[i] = FloatType(2.0 - 2.0 * std::cos((i + 1) * pi / (n + 1)));
+    }
+    EigenSystem rv;
+    rv.n           = n;
+    rv.eigenvalues = make_tensor({n}, evals);
+    rv.matrix      = make_tensor({n, n}, mat);
+    return rv;
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("BatchedEigenSolver", "", types) {
+    using pt = scf::eigen_solver::BatchedEigenSolve;
+    pluginplay::ModuleManager mm;
+    scf::load_modules(mm);
+
+    auto& mod = mm.at("Batched eigen solve");
+    auto rtol = std::is_same_v<TestType, float> ? 5e-4 : 1e-5;
+
+    SymmetricMatrixSpec spec;
+    spec.n                = 6;
+    spec.condition_number = 100.0;
+    spec.spacing          = EigenvalueSpacing::Linear;
+    spec.seed             = 23;
+    auto system2          = classic_2x2<TestType>();
+    auto system6          = generate_eigen_system<TestType>(spec);
+
+    SECTION("empty batch") {
+        std::vector<simde::type::tensor> matrices;
+        auto [values, vectors] = mod.run_as<pt>(matrices);
+        REQUIRE(values == simde::type::tensor{});
+        REQUIRE(vectors == simde::type::tensor{});
+    }
+
+    SECTION("mixed sizes") {
+        std::vector<simde::type::tensor> matrices{
+          system2.matrix, system6.matrix, system2.matrix};
+        std::vector<std::size_t> ns{2, 6, 2};
+
+        for(std::size_t max_threads : {1, 0}) {
+            mod.change_input("max threads", max_threads);
+            auto [values, vectors] = mod.run_as<pt>(matrices);
+
+            std::size_t value_offset  = 0;
+            std::size_t vector_offset = 0;
+            for(std::size_t k = 0; k < matrices.size(); ++k) {
+                const auto n       = ns[k];
+                const auto& system = n == 2 ? system2 : system6;
+                auto w = unpack<TestType>(values, value_offset, {n});
+                auto V = unpack<TestType>(vectors, vector_offset, {n, n});
+                require_eigenvalues_approx(w, system.eigenvalues, rtol);
+                require_eigenpair_residual(matrices[k], w, V, rtol);
+                value_offset += n;
+                vector_offset += n * n;
+            }
+        }
+    }
+
+    SECTION("bounded (9-32) and dynamic (> 32) sizes") {
+        // 12 and 32 use the fixed-capacity kernel, 33 and 40 the dynamic one
+        std::vector<EigenSystem> systems;
+        for(std::size_t n : {12, 32, 33, 40}) {
+            systems.push_back(second_difference<TestType>(n));
+        }
+        std::vector<simde::type::tensor> matrices;
+        for(const auto& system : systems) matrices.push_back(system.matrix);
+
+        for(std::size_t max_threads : {1, 0}) {
+            mod.change_input("max threads", max_threads);
+            auto [values, vectors] = mod.run_as<pt>(matrices);
+
+            std::size_t value_offset  = 0;
+            std::size_t vector_offset = 0;
+            for(const auto& system : systems) {
+                const auto n = system.n;
+                auto w = unpack<TestType>(values, value_offset, {n});
+                auto V = unpack<TestType>(vectors, vector_offset, {n, n});
+                require_eigenvalues_approx(w, system.eigenvalues, rtol);
+                require_eigenpair_residual(system.matrix, w, V, rtol);
+                value_offset += n;
+                vector_offset += n * n;
+            }
+        }
+    }
+
+    SECTION("non-square matrix throws") {
+        using tensorwrapper::utilities::make_tensor;
+        std::vector<TestType> data{1.0, 2.0};
+        std::vector<simde::type::tensor> matrices{make_tensor({1, 2}, data)};
+        REQUIRE_THROWS_AS(mod.run_as<pt>(matrices), std::runtime_error);
+    }
+}
@@ -16,6 +16,7 @@
 
 #include "h2_dimer_pencil.hpp"
 #include "test_eigen_solver.hpp"
+#include "eigen_solver/warm_start.hpp"
 
 using types = std::tuple<float, double>;
 using namespace test_eigen_solver;
@@ -35,3 +36,68 @@ TEMPLATE_LIST_TEST_CASE("GeneralizedEigenSolver H2 dimer", "", types) {
     require_eigenvalues_approx(values, eval_corr, rtol);
     require_eigenpair_residual(A, values, vectors, rtol);
 }
+
+TEMPLATE_LIST_TEST_CASE("GeneralizedEigenSolver warm start", "", types) {
+    using pt = simde::GeneralizedEigenSolve;
+    pluginplay::ModuleManager mm;
+    scf::load_modules(mm);
+    mm.change_submod("Generalized eigensolve", "Eigen Solve",
+                     "Eigen Solve via Jacobi");
+
+    auto rtol = std::is_same_v<TestType, float> ? 5e-4 : 1e-5;
+    auto A    = h2_dimer_fock_as<TestType>();
+    auto B    = h2_dimer_overlap_as<TestType>();
+
+    auto& mod                = mm.at("Generalized eigensolve");
+    auto [values0, vectors0] = mod.run_as<pt>(A, B);
+
+    mod.change_input("initial guess", vectors0);
+    auto [values, vectors] = mod.run_as<pt>(A, B);
+    auto eval_corr         = h2_dimer_evals<TestType>();
+    require_eigenvalues_approx(values, eval_corr, rtol);
+    require_eigenpair_residual(A, values, vectors, rtol);
+}
+
+TEST_CASE("uses_warm_start") {
+    using scf::eigen_solver::initial_guess_key;
+    using scf::eigen_solver::initial_rotation_key;
+    using scf::eigen_solver::uses_warm_start;
+    pluginplay::ModuleManager mm;
+    scf::load_modules(mm);
+
+    SECTION("direct solvers ignore it") {
+        const auto& mod = mm.at("Generalized eigensolve via Eigen");
+        REQUIRE_FALSE(uses_warm_start(mod, initial_guess_key));
+        const auto& normal = mm.at("Eigen Solve via Eigen");
+        REQUIRE_FALSE(uses_warm_start(normal, initial_rotation_key));
+    }
+
+    SECTION("Jacobi solvers use it") {
+        const auto& jacobi = mm.at("Eigen Solve via Jacobi");
+        REQUIRE(uses_warm_start(jacobi, initial_rotation_key));
+        const auto& two_phase = mm.at("Eigen Solve via two-phase Jacobi");
+        REQUIRE(uses_warm_start(two_phase, initial_rotation_key));
+    }
+
+    SECTION("forwarded only if a backend uses it") {
+        const auto& mod = mm.at("Generalized eigensolve");
+        REQUIRE(uses_warm_start(mod, initial_guess_key));
+
+        mm.change_submod("Generalized eigensolve", "Eigen Solve",
+                         "Eigen Solve via Eigen");
+        REQUIRE_FALSE(uses_warm_start(mod, initial_guess_key));
+    }
+
+    SECTION("only the backend selected for the float type counts") {
+        const auto& mod = mm.at("Generalized eigensolve");
+        const auto A    = h2_dimer_fock_as<double>();
+        REQUIRE_FALSE(uses_warm_start(mod, initial_guess_key, A));
+#ifdef ENABLE_SIGMA
+        const auto A_uq = h2_dimer_fock_as<tensorwrapper::types::udouble>();
+        REQUIRE(uses_warm_start(mod, initial_guess_key, A_uq));
+#endif
+
+        mm.change_submod("Eigen Solve", "none", "Eigen Solve via Jacobi");
+        REQUIRE(uses_warm_start(mod, initial_guess_key, A));
+    }
+}
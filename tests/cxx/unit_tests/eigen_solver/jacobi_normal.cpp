@@ -62,6 +62,21 @@ TEMPLATE_LIST_TEST_CASE("JacobiNormal", "", types) {
         require_eigenvalues_approx(values, system.eigenvalues, rtol);
         require_eigenpair_residual(system.matrix, values, vectors, rtol);
     }
+
+    SECTION("warm start from previous eigenvectors") {
+        SymmetricMatrixSpec spec;
+        spec.n                   = 4;
+        spec.condition_number    = 1e3;
+        spec.spacing             = EigenvalueSpacing::Linear;
+        spec.seed                = 11;
+        auto system              = generate_eigen_system<TestType>(spec);
+        auto [values0, vectors0] = mod.run_as<pt>(system.matrix);
+
+        mod.change_input("initial rotation", vectors0);
+        auto [values, vectors] = mod.run_as<pt>(system.matrix);
+        require_eigenvalues_approx(values, system.eigenvalues, 10 * rtol);
+        require_eigenpair_residual(system.matrix, values, vectors, rtol);
+    }
 }
 
 #ifdef ENABLE_SIGMA
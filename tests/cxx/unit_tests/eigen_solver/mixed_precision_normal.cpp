@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "h2_dimer_pencil.hpp"
+#include "test_eigen_solver.hpp"
+
+using types = std::tuple<float, double>;
+using namespace test_eigen_solver;
+using namespace tensorwrapper::generate;
+
+TEMPLATE_LIST_TEST_CASE("MixedPrecisionNormal", "", types) {
+    pluginplay::ModuleManager mm;
+    scf::load_modules(mm);
+
+    auto& mod = mm.at("Eigen Solve via mixed precision");
+    auto rtol = std::is_same_v<TestType, float> ? 1e-3 : 1e-10;
+    using pt  = simde::EigenSolve;
+
+    SECTION("classic 2 by 2") {
+        auto system            = classic_2x2<TestType>();
+        auto [values, vectors] = mod.run_as<pt>(system.matrix);
+
+        require_eigenvalues_approx(values, system.eigenvalues, rtol);
+        require_eigenpair_residual(system.matrix, values, vectors, rtol);
+    }
+
+    SECTION("generated n=4 condition number 1e3") {
+        SymmetricMatrixSpec spec;
+        spec.n                 = 4;
+        spec.condition_number  = 1e3;
+        spec.spacing           = EigenvalueSpacing::Linear;
+        spec.seed              = 11;
+        auto system            = generate_eigen_system<TestType>(spec);
+        auto [values, vectors] = mod.run_as<pt>(system.matrix);
+        require_eigenvalues_approx(values, system.eigenvalues, 10 * rtol);
+        require_eigenpair_residual(system.matrix, values, vectors, rtol);
+    }
+
+    SECTION("generated clustered n=6") {
+        // Clusters far tighter than single precision can separate are
+        // resolved by the refinement and returned as orthonormal vectors
+        for(double width : {1e-3, 1e-8}) {
+            SymmetricMatrixSpec spec;
+            spec.n                 = 6;
+            spec.condition_number  = 100.0;
+            spec.spacing           = EigenvalueSpacing::Clustered;
+            spec.n_clusters        = 3;
+            spec.cluster_width     = width;
+            spec.seed              = 23;
+            auto system            = generate_eigen_system<TestType>(spec);
+            auto [values, vectors] = mod.run_as<pt>(system.matrix);
+            require_eigenvalues_approx(values, system.eigenvalues, rtol);
+            require_eigenpair_residual(system.matrix, values, vectors, rtol);
+
+            using tensorwrapper::operations::approximately_equal;
+            using tensorwrapper::utilities::make_tensor;
+            std::vector<TestType> ones(spec.n, TestType(1));
+            auto I = tensorwrapper::utilities::diagonal_matrix(
+              make_tensor({spec.n}, ones));
+            simde::type::tensor VV;
+            VV("i,k") = vectors("j,i") * vectors("j,k");
+            REQUIRE(approximately_equal(VV, I, rtol));
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("MixedPrecisionNormal matches EigenGeneralized", "",
+                        types) {
+    using pt = simde::GeneralizedEigenSolve;
+    pluginplay::ModuleManager mm;
+    scf::load_modules(mm);
+    mm.change_submod("Generalized eigensolve", "Eigen Solve",
+                     "Eigen Solve via mixed precision");
+
+    auto rtol = std::is_same_v<TestType, float> ? 5e-4 : 1e-10;
+    auto A    = h2_dimer_fock_as<TestType>();
+    auto B    = h2_dimer_overlap_as<TestType>();
+
+    auto& mod              = mm.at("Generalized eigensolve");
+    auto& corr_mod         = mm.at("Generalized eigensolve via Eigen");
+    auto [values, vectors] = mod.run_as<pt>(A, B);
+    auto [corr_values, corr_vectors] = corr_mod.run_as<pt>(A, B);
+
+    require_eigenvalues_approx(values, corr_values, rtol);
+    require_eigenpair_residual(A, values, vectors, rtol);
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "eigen_solver/eigen_solver_property_types.hpp"
+#include "h2_dimer_pencil.hpp"
+#include "test_eigen_solver.hpp"
+#include <cmath>
+
+using types = std::tuple<float, double>;
+using namespace test_eigen_solver;
+
+namespace {
+
+// SALCs of the H2 dimer under the reflection which reverses the chain
+template<typename FloatType>
+simde::type::tensor h2_dimer_reversal_salcs() {
+    using tensorwrapper::utilities::make_tensor;
+    const auto r = static_cast<FloatType>(1.0 / std::sqrt(2.0));
+    const auto z = static_cast<FloatType>(0.0);
+    std::vector<FloatType> U{r, z, r, z, z, r, z, r, z, r, z, -r, r, z, -r, z};
+    return make_tensor({4, 4}, U);
+}
+
+// Homonuclear "diatomic" along z (centers at z = -1 and z = 1) with an s, a
+// Cartesian p, and a pure d shell on each center, i.e., 9 AOs per center
+inline auto spd_dimer_basis() {
+    using ao_basis_type            = chemist::basis_set::AOBasisSetD;
+    using atomic_basis_type        = typename ao_basis_type::value_type;
+    using shell_type               = typename atomic_basis_type::value_type;
+    using contracted_gaussian_type = typename shell_type::cg_type;
+    using center_type = typename atomic_basis_type::shell_traits::center_type;
+    using l_type      = typename shell_type::angular_momentum_type;
+
+    std::vector<double> coefs{0.4, 0.7};
+    std::vector<double> exps{2.0, 0.5};
+    ao_basis_type rv;
+    for(double z : {-1.0, 1.0}) {
+        center_type coords(0.0, 0.0, z);
+        contracted_gaussian_type cg(coefs.begin(), coefs.end(), exps.begin(),
+                                    exps.end(), coords);
+        atomic_basis_type abs("test", 7, coords);
+        abs.add_shell(chemist::ShellType::pure, l_type{0}, cg);
+        abs.add_shell(chemist::ShellType::cartesian, l_type{1}, cg);
+        abs.add_shell(chemist::ShellType::pure, l_type{2}, cg);
+        rv.add_center(abs);
+    }
+    return rv;
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("SymmetryBlockedGeneralized H2 dimer", "", types) {
+    using pt = simde::GeneralizedEigenSolve;
+    pluginplay::ModuleManager mm;
+    scf::load_modules(mm);
+
+    auto rtol      = std::is_same_v<TestType, float> ? 5e-4 : 1e-5;
+    auto A         = h2_dimer_fock_as<TestType>();
+    auto B         = h2_dimer_overlap_as<TestType>();
+    auto eval_corr = h2_dimer_evals<TestType>();
+
+    auto& mod = mm.at("Generalized eigensolve via symmetry blocks");
+
+    SECTION("no SALCs") {
+        auto [values, vectors] = mod.run_as<pt>(A, B);
+        require_eigenvalues_approx(values, eval_corr, rtol);
+        require_eigenpair_residual(A, values, vectors, rtol);
+    }
+
+    SECTION("reversal SALCs") {
+        mod.change_input("SALC transform",
+                         h2_dimer_reversal_salcs<TestType>());
+        for(std::size_t max_threads : {1, 0}) {
+            mod.change_input("max threads", max_threads);
+            auto [values, vectors] = mod.run_as<pt>(A, B);
+            require_eigenvalues_approx(values, eval_corr, rtol);
+            require_eigenpair_residual(A, values, vectors, rtol);
+        }
+    }
+}
+
+TEST_CASE("D2hSALCs") {
+    using pt = scf::eigen_solver::salc_conversion_t;
+    pluginplay::ModuleManager mm;
+    scf::load_modules(mm);
+    auto& mod = mm.at("D2h SALCs");
+
+    SECTION("H2") {
+        auto h2  = test_scf::make_h2<simde::type::nuclei>();
+        auto aos = test_scf::h_basis(h2);
+        auto U   = mod.run_as<pt>(aos);
+
+        // sigma_g and sigma_u combinations of the two 1s functions
+        using tensorwrapper::buffer::make_contiguous;
+        const auto& buffer = make_contiguous(U.buffer());
+        auto data = tensorwrapper::buffer::get_raw_data<double>(buffer);
+        REQUIRE(data.size() == 4);
+        const double r = 1.0 / std::sqrt(2.0);
+        for(auto x : data) REQUIRE(std::abs(x) == Catch::Approx(r));
+        REQUIRE(data[0] * data[1] + data[2] * data[3] ==
+                Catch::Approx(0.0).margin(1e-12));
+    }
+
+    SECTION("He") {
+        auto he  = test_scf::make_he<simde::type::nuclei>();
+        auto aos = test_scf::he_basis(he);
+        auto U   = mod.run_as<pt>(aos);
+
+        using tensorwrapper::utilities::make_tensor;
+        auto corr = make_tensor({1, 1}, std::vector<double>{1.0});
+        REQUIRE(tensorwrapper::operations::approximately_equal(U, corr, 1e-12));
+    }
+
+    SECTION("s, p, and d shells") {
+        auto aos = spd_dimer_basis();
+        auto U   = mod.run_as<pt>(aos);
+
+        using tensorwrapper::buffer::make_contiguous;
+        const auto& buffer = make_contiguous(U.buffer());
+        auto data = tensorwrapper::buffer::get_raw_data<double>(buffer);
+        const std::size_t n_per_center = 9;
+        const std::size_t n            = 2 * n_per_center;
+        REQUIRE(data.size() == n * n);
+
+        // U is orthogonal
+        for(std::size_t j = 0; j < n; ++j) {
+            for(std::size_t k = 0; k < n; ++k) {
+                double ujk = 0.0;
+                for(std::size_t i = 0; i < n; ++i) {
+                    ujk += data[i * n + j] * data[i * n + k];
+                }
+                REQUIRE(ujk == Catch::Approx(j == k ? 1.0 : 0.0).margin(1e-10));
+            }
+        }
+
+        // Signs of (s, p_x, p_y, p_z, d_-2, ..., d_2) under inversion,
+        // (-1)^l, which also swaps the centers, and under C2(z), (-1)^m
+        std::vector<int> inversion{1, -1, -1, -1, 1, 1, 1, 1, 1};
+        std::vector<int> c2z{1, -1, -1, 1, 1, -1, 1, -1, 1};
+
+        // Every SALC is even or odd under both operations; half of them are
+        // gerade and 5 of the 9 functions per center are even under C2(z)
+        std::size_t n_gerade   = 0;
+        std::size_t n_c2z_even = 0;
+        for(std::size_t j = 0; j < n; ++j) {
+            double inv_dot = 0.0;
+            double c2z_dot = 0.0;
+            for(std::size_t mu = 0; mu < n; ++mu) {
+                const auto k     = mu % n_per_center;
+                const auto image = (mu + n_per_center) % n;
+                const auto v_mu  = data[mu * n + j];
+                inv_dot += v_mu * inversion[k] * data[image * n + j];
+                c2z_dot += v_mu * c2z[k] * v_mu;
+            }
+            REQUIRE(std::abs(inv_dot) == Catch::Approx(1.0));
+            REQUIRE(std::abs(c2z_dot) == Catch::Approx(1.0));
+            if(inv_dot > 0.0) ++n_gerade;
+            if(c2z_dot > 0.0) ++n_c2z_even;
+        }
+        REQUIRE(n_gerade == n_per_center);
+        REQUIRE(n_c2z_even == 10);
+    }
+}
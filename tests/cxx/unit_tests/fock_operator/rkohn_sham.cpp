@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include <scf/scf.hpp>
+#include <simde/simde.hpp>
+
+using namespace chemist::qm_operator;
+
+TEMPLATE_LIST_TEST_CASE("RKohnSham", "", test_scf::float_types) {
+    pluginplay::ModuleManager mm;
+    scf::load_modules(mm);
+    using float_type   = double;
+    using density_type = simde::type::decomposable_e_density;
+    using pt           = simde::FockOperator<density_type>;
+    using e_type       = simde::type::many_electrons;
+    auto H             = test_scf::h2_hamiltonian();
+    auto h2            = test_scf::make_h2<simde::type::nuclei>();
+    auto rho           = test_scf::h2_density<float_type>();
+    e_type es(2);
+
+    auto& mod = mm.at("Restricted Kohn-Sham Op");
+
+    // T + V_en + 2J + XC, i.e., the Kohn-Sham operator of a pure functional
+    auto ks_op = [&](xc_functional func) {
+        simde::type::fock F;
+        using t_type  = Kinetic<e_type>;
+        using v_type  = Coulomb<e_type, chemist::Nuclei>;
+        using j_type  = Coulomb<e_type, density_type>;
+        using xc_type = ExchangeCorrelation<e_type, density_type>;
+        F.emplace_back(1.0, std::make_unique<t_type>(es));
+        F.emplace_back(1.0, std::make_unique<v_type>(es, h2));
+        F.emplace_back(2.0, std::make_unique<j_type>(es, rho));
+        F.emplace_back(1.0, std::make_unique<xc_type>(func, es, rho));
+        return F;
+    };
+
+    SECTION("Pure functional") {
+        auto func = xc_functional::PBE;
+        mod.change_input("XC Potential", func);
+        auto F = mod.run_as<pt>(H, rho);
+        REQUIRE(F == ks_op(func));
+    }
+
+    SECTION("Hybrid functional") {
+        auto func = xc_functional::PBE0;
+        mod.change_input("XC Potential", func);
+        using k_type = Exchange<e_type, density_type>;
+        auto F       = mod.run_as<pt>(H, rho);
+        auto F_corr  = ks_op(func);
+        F_corr.emplace_back(-0.25, std::make_unique<k_type>(es, rho));
+        REQUIRE(F == F_corr);
+    }
+}
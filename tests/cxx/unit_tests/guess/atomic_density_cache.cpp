@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "guess/atomic_density_cache.hpp"
+#include "guess/atomic_scf.hpp"
+#include <cmath>
+#include <filesystem>
+
+using namespace scf::guess;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+// Integrals of Z with an even-tempered basis of s Gaussians on one center
+struct SAtom {
+    SAtom(double Z, std::size_t n) :
+      n(n), S(n * n), H(n * n), eri(n * n * n * n) {
+        std::vector<double> a(n);
+        for(std::size_t i = 0; i < n; ++i) a[i] = 0.05 * std::pow(3.0, i);
+        auto norm = [](double x) { return std::pow(2.0 * x / M_PI, 0.75); };
+        for(std::size_t i = 0; i < n; ++i) {
+            for(std::size_t j = 0; j < n; ++j) {
+                const double p = a[i] + a[j];
+                const double r = 2.0 * std::sqrt(a[i] * a[j]) / p;
+                const double s = std::pow(r, 1.5);
+                const double v = -Z * 2.0 * M_PI / p * norm(a[i]) * norm(a[j]);
+                S[i * n + j] = s;
+                H[i * n + j] = 3.0 * a[i] * a[j] / p * s + v;
+                for(std::size_t k = 0; k < n; ++k) {
+                    for(std::size_t l = 0; l < n; ++l) {
+                        const double q = a[k] + a[l];
+                        const double c = norm(a[i]) * norm(a[j]) *
+                                         norm(a[k]) * norm(a[l]);
+                        eri[((i * n + j) * n + k) * n + l] =
+                          c * 2.0 * std::pow(M_PI, 2.5) /
+                          (p * q * std::sqrt(p + q));
+                    }
+                }
+            }
+        }
+    }
+
+    // E = Tr[P(2H + G)] for the restricted density P
+    double energy(const std::vector<double>& P) const {
+        double e = 0.0;
+        for(std::size_t m = 0; m < n; ++m) {
+            for(std::size_t v = 0; v < n; ++v) {
+                double g = 0.0;
+                for(std::size_t l = 0; l < n; ++l)
+                    for(std::size_t s = 0; s < n; ++s)
+                        g += P[l * n + s] *
+                             (2.0 * eri[((m * n + v) * n + l) * n + s] -
+                              eri[((m * n + l) * n + v) * n + s]);
+                e += P[m * n + v] * (2.0 * H[m * n + v] + g);
+            }
+        }
+        return e;
+    }
+
+    std::size_t n;
+    std::vector<double> S, H, eri;
+};
+
+} // namespace
+
+TEST_CASE("fractional_occupations") {
+    Eigen::VectorXd e(5);
+    e << -1.0, -0.5, -0.2, -0.2, -0.2;
+
+    SECTION("closed shells") {
+        auto w = fractional_occupations(e, 4.0);
+        REQUIRE(w == std::vector<double>{1.0, 1.0, 0.0, 0.0, 0.0});
+    }
+
+    SECTION("partially filled shell is averaged") {
+        auto w = fractional_occupations(e, 5.0);
+        REQUIRE(w[1] == 1.0);
+        for(std::size_t i = 2; i < 5; ++i)
+            REQUIRE_THAT(w[i], WithinAbs(1.0 / 6.0, 1E-12));
+    }
+
+    SECTION("too many electrons") {
+        REQUIRE_THROWS_AS(fractional_occupations(e, 11.0), std::runtime_error);
+    }
+}
+
+TEST_CASE("atomic_scf_density") {
+    SECTION("He") {
+        SAtom he(2.0, 10);
+        auto P = atomic_scf_density(he.S, he.H, he.eri, he.n, 2.0);
+        REQUIRE_THAT(he.energy(P), WithinAbs(-2.861597, 1E-5));
+    }
+
+    SECTION("fractional occupation conserves the electrons") {
+        SAtom li(3.0, 10);
+        auto P    = atomic_scf_density(li.S, li.H, li.eri, li.n, 3.0);
+        double tr = 0.0;
+        for(std::size_t i = 0; i < P.size(); ++i) tr += P[i] * li.S[i];
+        REQUIRE_THAT(tr, WithinAbs(1.5, 1E-10));
+    }
+}
+
+TEST_CASE("AtomicDensityCache") {
+    auto& cache = AtomicDensityCache::instance();
+    cache.clear();
+    AtomicDensityCache::key_type h{1, 42}, he{2, 42};
+    AtomicDensityCache::block_type h_block{0.5};
+    AtomicDensityCache::block_type he_block{1.0, 0.1, 0.1, 0.2};
+
+    cache.insert(h, h_block);
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.find(h).value() == h_block);
+    REQUIRE_FALSE(cache.find(he).has_value());
+
+    SECTION("insert does not overwrite") {
+        cache.insert(h, AtomicDensityCache::block_type{0.0});
+        REQUIRE(cache.find(h).value() == h_block);
+    }
+
+    SECTION("file round trip") {
+        auto path = std::filesystem::temp_directory_path();
+        path /= "scf_atomic_density_cache_test.bin";
+        cache.insert(he, he_block);
+        cache.save(path);
+        cache.clear();
+        REQUIRE(cache.size() == 0);
+
+        // The temporary file was renamed onto path
+        const auto prefix = path.filename().string() + ".";
+        for(const auto& entry :
+            std::filesystem::directory_iterator(path.parent_path())) {
+            const auto name = entry.path().filename().string();
+            REQUIRE(name.rfind(prefix, 0) == std::string::npos);
+        }
+
+        cache.load(path);
+        REQUIRE(cache.size() == 2);
+        REQUIRE(cache.find(h).value() == h_block);
+        REQUIRE(cache.find(he).value() == he_block);
+        std::filesystem::remove(path);
+    }
+
+    SECTION("missing file is not an error") {
+        REQUIRE_NOTHROW(cache.load("/no/such/atomic_density_file.bin"));
+        REQUIRE(cache.size() == 1);
+    }
+    cache.clear();
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "guess/fragments.hpp"
+
+using namespace scf::guess;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("covalent_radius") {
+    REQUIRE_THAT(covalent_radius(1), WithinAbs(0.31 / 0.529177210903, 1E-12));
+    REQUIRE_THAT(covalent_radius(8), WithinAbs(0.66 / 0.529177210903, 1E-12));
+    REQUIRE_THAT(covalent_radius(92), WithinAbs(1.5 / 0.529177210903, 1E-12));
+}
+
+TEST_CASE("bonded_fragments") {
+    // Two waters 10 bohr apart, with the atoms of the second one listed
+    // between those of the first one
+    std::vector<std::array<double, 3>> r{
+      {0.0, 0.0, 0.0},  {10.0, 0.0, 0.0}, {1.8, 0.0, 0.0},
+      {11.8, 0.0, 0.0}, {10.0, 1.8, 0.0}, {-0.5, 1.7, 0.0}};
+    std::vector<unsigned int> Z{8, 8, 1, 1, 1, 1};
+
+    auto fragments = bonded_fragments(r, Z);
+    REQUIRE(fragments.size() == 2);
+    REQUIRE(fragments[0] == fragment_type{0, 2, 5});
+    REQUIRE(fragments[1] == fragment_type{1, 3, 4});
+
+    SECTION("A small enough scale breaks the bonds") {
+        REQUIRE(bonded_fragments(r, Z, 0.1).size() == 6);
+    }
+
+    SECTION("Mismatched inputs") {
+        Z.pop_back();
+        REQUIRE_THROWS_AS(bonded_fragments(r, Z), std::runtime_error);
+    }
+}
+
+TEST_CASE("check_partition") {
+    REQUIRE_NOTHROW(check_partition({{0, 2}, {1}}, 3));
+    REQUIRE_THROWS_AS(check_partition({{0, 2}, {}}, 3), std::runtime_error);
+    REQUIRE_THROWS_AS(check_partition({{0, 2}}, 3), std::runtime_error);
+    REQUIRE_THROWS_AS(check_partition({{0, 2}, {2, 1}}, 3),
+                      std::runtime_error);
+    REQUIRE_THROWS_AS(check_partition({{0, 3}, {1}}, 3), std::runtime_error);
+}
+
+TEST_CASE("mcweeny_purify") {
+    // Orthonormal basis, so the eigenvalues of P itself go to 0 or 1
+    std::vector<double> S{1.0, 0.0, 0.0, 1.0};
+    std::vector<double> P{0.9, 0.0, 0.0, 0.1};
+
+    auto P1 = mcweeny_purify(P, S, 2, 1);
+    REQUIRE_THAT(P1[0], WithinAbs(3.0 * 0.81 - 2.0 * 0.729, 1E-12));
+    REQUIRE_THAT(P1[3], WithinAbs(3.0 * 0.01 - 2.0 * 0.001, 1E-12));
+
+    auto P5 = mcweeny_purify(P, S, 2, 5);
+    REQUIRE_THAT(P5[0], WithinAbs(1.0, 1E-10));
+    REQUIRE_THAT(P5[1], WithinAbs(0.0, 1E-12));
+    REQUIRE_THAT(P5[3], WithinAbs(0.0, 1E-10));
+
+    SECTION("Idempotent densities are fixed points") {
+        // P = c c^T with c^T S c = 1 in a non-orthogonal basis
+        const double s = 0.5;
+        std::vector<double> S_no{1.0, s, s, 1.0};
+        const double c = 1.0 / std::sqrt(2.0 + 2.0 * s);
+        std::vector<double> P_no(4, c * c);
+        auto P_pure = mcweeny_purify(P_no, S_no, 2, 3);
+        for(std::size_t i = 0; i < 4; ++i)
+            REQUIRE_THAT(P_pure[i], WithinAbs(c * c, 1E-12));
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "guess/huckel_parameters.hpp"
+
+using namespace scf::guess;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("aufbau_configuration") {
+    SECTION("carbon") {
+        auto c = aufbau_configuration(6);
+        REQUIRE(c.size() == 3);
+        REQUIRE(c[2].n == 2);
+        REQUIRE(c[2].l == 1);
+        REQUIRE(c[2].occupation == 2);
+    }
+
+    SECTION("4s fills before 3d") {
+        auto fe = aufbau_configuration(26);
+        REQUIRE(fe.back().n == 3);
+        REQUIRE(fe.back().l == 2);
+        REQUIRE(fe.back().occupation == 6);
+        REQUIRE(fe[fe.size() - 2].n == 4);
+    }
+
+    SECTION("out of range") {
+        REQUIRE_THROWS_AS(aufbau_configuration(0), std::runtime_error);
+    }
+}
+
+TEST_CASE("slater_orbital_energy") {
+    // C 2p: Z_eff = 6 - 3(0.35) - 2(0.85) = 3.25
+    REQUIRE_THAT(slater_orbital_energy(6, 2, 1),
+                 WithinAbs(-0.5 * 3.25 * 3.25 / 4.0, 1E-12));
+    // H 1s is unscreened
+    REQUIRE_THAT(slater_orbital_energy(1, 1, 0), WithinAbs(-0.5, 1E-12));
+    // A 3d electron on C is completely screened
+    REQUIRE_THAT(slater_orbital_energy(6, 3, 2), WithinAbs(0.0, 1E-12));
+}
+
+TEST_CASE("tabulated_ionization_potential") {
+    REQUIRE_THAT(tabulated_ionization_potential(1, 1, 0).value(),
+                 WithinAbs(13.6 / 27.211386245988, 1E-12));
+    REQUIRE(tabulated_ionization_potential(8, 2, 1).has_value());
+    REQUIRE_FALSE(tabulated_ionization_potential(8, 1, 0).has_value());
+    REQUIRE_FALSE(tabulated_ionization_potential(26, 4, 0).has_value());
+}
+
+TEST_CASE("ao_ionization_potentials") {
+    auto h2  = test_scf::make_h2<simde::type::nuclei>();
+    auto aos = test_scf::h_basis(h2);
+    auto ips = ao_ionization_potentials(aos[0]);
+    REQUIRE(ips.size() == 1);
+    REQUIRE_THAT(ips[0], WithinAbs(13.6 / 27.211386245988, 1E-12));
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "guess/sap_potential.hpp"
+#include <cmath>
+
+using namespace scf::guess;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("sap_effective_charge") {
+    SECTION("bare nucleus at the origin") {
+        REQUIRE_THAT(sap_effective_charge(8.0, 0.0), WithinAbs(8.0, 1E-12));
+    }
+
+    SECTION("screened in between") {
+        const auto z = sap_effective_charge(8.0, 1.0);
+        REQUIRE(z > 1.0);
+        REQUIRE(z < 8.0);
+        REQUIRE(sap_effective_charge(1.0, 0.5) < 1.0);
+    }
+
+    SECTION("neutral far away") {
+        REQUIRE(sap_effective_charge(8.0, 50.0) < 1E-2);
+        REQUIRE(sap_effective_charge(8.0, 500.0) < 1E-4);
+        REQUIRE(sap_effective_charge(1.0, 50.0) < 1E-3);
+    }
+}
+
+TEST_CASE("gauss_legendre") {
+    auto [x, w] = gauss_legendre(5);
+    REQUIRE(x.size() == 5);
+    double sum = 0.0, x8 = 0.0;
+    for(std::size_t i = 0; i < 5; ++i) {
+        sum += w[i];
+        x8 += w[i] * std::pow(x[i], 8);
+    }
+    REQUIRE_THAT(sum, WithinAbs(2.0, 1E-14));
+    REQUIRE_THAT(x8, WithinAbs(2.0 / 9.0, 1E-14));
+}
+
+TEST_CASE("spherical_grid") {
+    auto grid = spherical_grid(50, 11);
+    REQUIRE(grid.size() == 50 * 11 * 22);
+
+    double gaussian = 0.0, z2 = 0.0, coulomb = 0.0;
+    for(const auto& [x, y, z, w] : grid) {
+        const double r2 = x * x + y * y + z * z;
+        gaussian += w * std::exp(-r2);
+        z2 += w * z * z * std::exp(-r2);
+        coulomb += w * std::exp(-2.0 * r2) / std::sqrt(r2);
+    }
+    const double pi32 = std::pow(M_PI, 1.5);
+    REQUIRE_THAT(gaussian, WithinAbs(pi32, 1E-8));
+    REQUIRE_THAT(z2, WithinAbs(pi32 / 2.0, 1E-8));
+    REQUIRE_THAT(coulomb, WithinAbs(M_PI, 1E-6));
+}
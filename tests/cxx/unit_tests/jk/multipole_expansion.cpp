@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "jk/multipole_expansion.hpp"
+#include <cmath>
+
+using namespace scf::jk;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("CartesianExpansion") {
+    using point_type = CartesianExpansion::point_type;
+
+    SECTION("component ordering") {
+        CartesianExpansion e(2);
+        REQUIRE(e.size() == 10);
+        REQUIRE(e.index(0) == CartesianExpansion::index_type{0, 0, 0});
+        REQUIRE(e.index(2) == CartesianExpansion::index_type{0, 1, 0});
+        REQUIRE(e.index(5) == CartesianExpansion::index_type{1, 1, 0});
+        REQUIRE(e.index(9) == CartesianExpansion::index_type{0, 0, 2});
+        for(std::size_t i = 0; i < e.size(); ++i)
+            REQUIRE(CartesianExpansion::position(e.index(i)) == i);
+        REQUIRE(e.inverse_factorial(4) == 0.5);
+    }
+
+    SECTION("coulomb_derivatives") {
+        CartesianExpansion e(2);
+        point_type R{1.0, 2.0, 2.0};
+        auto D = e.coulomb_derivatives(R);
+        REQUIRE_THAT(D[0], WithinAbs(1.0 / 3.0, 1E-14));
+        // -X / r^3, 3X^2 / r^5 - 1 / r^3, and 3YZ / r^5
+        REQUIRE_THAT(D[1], WithinAbs(-1.0 / 27.0, 1E-14));
+        REQUIRE_THAT(D[4], WithinAbs(-6.0 / 243.0, 1E-14));
+        REQUIRE_THAT(D[8], WithinAbs(12.0 / 243.0, 1E-14));
+    }
+
+    SECTION("point charges") {
+        // Sources near S and targets near T; compare the expansion, with
+        // multipoles and the local expansion each translated once, to the
+        // exact Coulomb energy
+        const std::vector<std::array<double, 4>> sources{
+          {0.3, -0.2, 0.1, 1.0}, {-0.4, 0.1, 0.2, -0.5}, {0.1, 0.4, -0.3, 0.7}};
+        const std::vector<std::array<double, 4>> targets{
+          {4.2, 0.9, 2.3, 0.8}, {3.7, 1.4, 1.8, -1.2}, {4.0, 1.0, 2.0, 0.4}};
+        const point_type S0{0.2, 0.0, 0.0}, S{0.0, 0.1, 0.0};
+        const point_type T0{4.1, 1.0, 2.1}, T{4.0, 1.1, 2.0};
+
+        double exact = 0.0;
+        for(const auto& s : sources)
+            for(const auto& t : targets)
+                exact += s[3] * t[3] /
+                         std::hypot(s[0] - t[0], s[1] - t[1], s[2] - t[2]);
+
+        auto moments = [](const CartesianExpansion& e, const auto& charges,
+                          const point_type& center) {
+            CartesianExpansion::vector_type M(e.size(), 0.0);
+            for(const auto& q : charges)
+                for(std::size_t c = 0; c < e.size(); ++c) {
+                    double value = q[3];
+                    for(unsigned x = 0; x < 3; ++x)
+                        value *= std::pow(q[x] - center[x], e.index(c)[x]);
+                    M[c] += value;
+                }
+            return M;
+        };
+
+        double previous_error = 1.0;
+        for(unsigned p : {0u, 2u, 4u, 6u}) {
+            CartesianExpansion e(p);
+            const point_type s_shift{S0[0] - S[0], S0[1] - S[1],
+                                     S0[2] - S[2]};
+            const point_type R{T0[0] - S[0], T0[1] - S[1], T0[2] - S[2]};
+            const point_type t_shift{T[0] - T0[0], T[1] - T0[1],
+                                     T[2] - T0[2]};
+
+            auto M = e.translate_multipoles(moments(e, sources, S0), s_shift);
+            CartesianExpansion::vector_type L(e.size(), 0.0);
+            e.multipoles_to_local(M, R, L);
+            L = e.translate_local(L, t_shift);
+
+            const auto M_t   = moments(e, targets, T);
+            const auto error = std::fabs(e.contract(L, M_t.data()) - exact);
+            REQUIRE(error < previous_error);
+            previous_error = error;
+        }
+        REQUIRE(previous_error < 1E-5);
+    }
+}
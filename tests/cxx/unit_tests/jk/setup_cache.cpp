@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "jk/setup_cache.hpp"
+
+using namespace scf::jk;
+
+TEST_CASE("basis_fingerprint") {
+    const auto h2 = test_scf::h2_aos();
+    REQUIRE(basis_fingerprint(h2) == basis_fingerprint(test_scf::h2_aos()));
+    REQUIRE(basis_fingerprint(h2) != basis_fingerprint(test_scf::he_aos()));
+}
+
+TEST_CASE("SetupCache") {
+    SetupCache cache;
+    std::size_t n_built = 0;
+    auto make           = [&]() {
+        ++n_built;
+        return std::make_shared<std::size_t>(n_built);
+    };
+
+    SetupKey key{1, nullptr, typeid(double), {1.0E-10}, ""};
+    auto first = cache.get<std::size_t>(key, make);
+    REQUIRE(*first == 1);
+
+    SECTION("Same key") {
+        auto second = cache.get<std::size_t>(key, make);
+        REQUIRE(second == first);
+        REQUIRE(n_built == 1);
+    }
+
+    SECTION("Different key") {
+        key.parameters[0] = 1.0E-12;
+        auto second       = cache.get<std::size_t>(key, make);
+        REQUIRE(*second == 2);
+        REQUIRE(*first == 1);
+    }
+}
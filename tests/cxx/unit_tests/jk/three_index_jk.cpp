@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "jk/three_index_jk.hpp"
+#include <cmath>
+
+using namespace scf::jk;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+// K_mn = sum_Q sum_ls B_Qml B_Qns P_ls, element by element
+std::vector<double> reference_k(const std::vector<double>& B,
+                                const std::vector<double>& P, std::size_t n_q,
+                                std::size_t n) {
+    std::vector<double> K(n * n, 0.0);
+    for(std::size_t q = 0; q < n_q; ++q)
+        for(std::size_t m = 0; m < n; ++m)
+            for(std::size_t nu = 0; nu < n; ++nu)
+                for(std::size_t l = 0; l < n; ++l)
+                    for(std::size_t s = 0; s < n; ++s)
+                        K[m * n + nu] += B[(q * n + m) * n + l] *
+                                         B[(q * n + nu) * n + s] * P[l * n + s];
+    return K;
+}
+
+} // namespace
+
+TEST_CASE("ThreeIndexJK") {
+    const std::size_t n_q = 2, n = 3;
+    // Symmetric B^Q
+    std::vector<double> B{1.0, 0.2, 0.1, 0.2, 0.8, 0.3, 0.1, 0.3, 0.6,
+                          0.5, 0.1, 0.0, 0.1, 0.4, 0.2, 0.0, 0.2, 0.9};
+    ThreeIndexJK<double> jk(B.data(), n_q, n);
+    using matrix_type = ThreeIndexJK<double>::matrix_type;
+    using vector_type = ThreeIndexJK<double>::vector_type;
+
+    SECTION("semidefinite density: Cholesky factors") {
+        // P = 2 c c^T for one normalized "occupied orbital" c
+        const double c[3] = {0.6, 0.0, 0.8};
+        std::vector<double> P(n * n);
+        for(std::size_t i = 0; i < n; ++i)
+            for(std::size_t j = 0; j < n; ++j) P[i * n + j] = 2 * c[i] * c[j];
+
+        matrix_type X;
+        vector_type S;
+        jk.factor_density(P.data(), 1.0E-12, X, S);
+        REQUIRE(X.cols() == 1);
+        REQUIRE(S(0) == 1.0);
+
+        const auto K    = jk.exchange(P.data(), 1.0E-12);
+        const auto corr = reference_k(B, P, n_q, n);
+        for(std::size_t i = 0; i < n * n; ++i)
+            REQUIRE_THAT(K[i], WithinAbs(corr[i], 1.0E-12));
+    }
+
+    SECTION("indefinite density: eigen factors") {
+        std::vector<double> P{0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.5};
+
+        matrix_type X;
+        vector_type S;
+        jk.factor_density(P.data(), 1.0E-12, X, S);
+        REQUIRE(X.cols() == 3);
+        REQUIRE((S.array() < 0.0).count() == 1);
+
+        const auto K    = jk.exchange(P.data(), 1.0E-12);
+        const auto corr = reference_k(B, P, n_q, n);
+        for(std::size_t i = 0; i < n * n; ++i)
+            REQUIRE_THAT(K[i], WithinAbs(corr[i], 1.0E-12));
+    }
+}
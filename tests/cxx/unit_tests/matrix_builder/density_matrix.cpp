@@ -25,16 +25,51 @@ TEMPLATE_LIST_TEST_CASE("Density Matrix Builder", "", test_scf::float_types) {
     auto& mod = mm.at("Density matrix builder");
     auto aos  = test_scf::h2_aos();
     auto cmos = test_scf::h2_cmos<float_type>();
-    std::vector<int> occs{1, 0};
-    simde::type::rho_e<simde::type::cmos> rho_hat(cmos, occs);
-
-    chemist::braket::BraKet p_mn(aos, rho_hat, aos);
-    const auto& P = mod.run_as<pt>(p_mn);
+    using tensorwrapper::operations::approximately_equal;
     tensorwrapper::shape::Smooth corr_shape{2, 2};
-    float_type init{0.31980835};
-    auto corr_buffer = tensorwrapper::buffer::make_contiguous(corr_shape, init);
-    tensorwrapper::Tensor corr(corr_shape, std::move(corr_buffer));
 
-    using tensorwrapper::operations::approximately_equal;
-    REQUIRE(approximately_equal(P, corr, 1E-6));
+    SECTION("occupied orbital first") {
+        std::vector<int> occs{1, 0};
+        simde::type::rho_e<simde::type::cmos> rho_hat(cmos, occs);
+
+        chemist::braket::BraKet p_mn(aos, rho_hat, aos);
+        const auto& P = mod.run_as<pt>(p_mn);
+        float_type init{0.31980835};
+        auto corr_buffer =
+          tensorwrapper::buffer::make_contiguous(corr_shape, init);
+        tensorwrapper::Tensor corr(corr_shape, std::move(corr_buffer));
+
+        REQUIRE(approximately_equal(P, corr, 1E-6));
+    }
+
+    SECTION("non-contiguous occupations") {
+        std::vector<int> occs{0, 1};
+        simde::type::rho_e<simde::type::cmos> rho_hat(cmos, occs);
+
+        chemist::braket::BraKet p_mn(aos, rho_hat, aos);
+        const auto& P = mod.run_as<pt>(p_mn);
+        auto corr_buffer =
+          tensorwrapper::buffer::make_contiguous<float_type>(corr_shape);
+        corr_buffer.set_elem({0, 0}, float_type{1.14530664});
+        corr_buffer.set_elem({0, 1}, float_type{-1.14530664});
+        corr_buffer.set_elem({1, 0}, float_type{-1.14530664});
+        corr_buffer.set_elem({1, 1}, float_type{1.14530664});
+        tensorwrapper::Tensor corr(corr_shape, std::move(corr_buffer));
+
+        REQUIRE(approximately_equal(P, corr, 1E-6));
+    }
+
+    SECTION("weighted occupations") {
+        std::vector<int> occs{2, 0};
+        simde::type::rho_e<simde::type::cmos> rho_hat(cmos, occs);
+
+        chemist::braket::BraKet p_mn(aos, rho_hat, aos);
+        const auto& P = mod.run_as<pt>(p_mn);
+        float_type init{0.6396167};
+        auto corr_buffer =
+          tensorwrapper::buffer::make_contiguous(corr_shape, init);
+        tensorwrapper::Tensor corr(corr_shape, std::move(corr_buffer));
+
+        REQUIRE(approximately_equal(P, corr, 1E-6));
+    }
 }
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "matrix_builder/matrix_kernels.hpp"
+
+using namespace scf::matrix_builder;
+
+TEMPLATE_LIST_TEST_CASE("matrix_kernels", "", test_scf::float_types) {
+    using float_type = TestType;
+    using tensorwrapper::operations::approximately_equal;
+    using tensorwrapper::utilities::make_tensor;
+
+    auto make = [](std::vector<double> values) {
+        std::vector<float_type> data(values.begin(), values.end());
+        return make_tensor({2, 2}, data);
+    };
+    auto A = make({1.0, 2.0, 2.0, 3.0});
+    auto B = make({4.0, -1.0, -1.0, 0.5});
+
+    SECTION("MatrixAccumulator") {
+        MatrixAccumulator W;
+        REQUIRE(W.empty());
+        REQUIRE(W.release() == simde::type::tensor{});
+
+        W.add(2.0, A);
+        W.add(-1.0, B);
+        REQUIRE_FALSE(W.empty());
+        auto corr = make({-2.0, 5.0, 5.0, 5.5});
+        REQUIRE(approximately_equal(W.release(), corr, 1E-12));
+        REQUIRE(W.empty());
+
+        W.add(1.0, A);
+        auto C = make_tensor({3}, std::vector<float_type>(3, float_type{1}));
+        REQUIRE_THROWS_AS(W.add(1.0, C), std::runtime_error);
+    }
+
+    SECTION("symmetric_trace_product") {
+        // 1*4 + 2*(2*-1) + 3*0.5
+        tensorwrapper::shape::Smooth scalar{};
+        auto corr_buffer =
+          tensorwrapper::buffer::make_contiguous<float_type>(scalar);
+        corr_buffer.set_elem({}, float_type{1.5});
+        tensorwrapper::Tensor corr(scalar, std::move(corr_buffer));
+        auto tr = symmetric_trace_product(A, B);
+        REQUIRE(approximately_equal(tr, corr, 1E-12));
+
+        auto C = make_tensor({3}, std::vector<float_type>(3, float_type{1}));
+        REQUIRE_THROWS_AS(symmetric_trace_product(A, C), std::runtime_error);
+    }
+}
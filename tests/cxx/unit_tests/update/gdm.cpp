@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "update/gdm.hpp"
+#include <cmath>
+
+using namespace scf::update;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("LBFGS") {
+    // Minimizes 1/2 x^T A x - b^T x, starting from x = 0
+    Eigen::MatrixXd A(3, 3);
+    A << 4.0, 1.0, 0.0, 1.0, 3.0, 0.5, 0.0, 0.5, 2.0;
+    Eigen::VectorXd b(3), h0_inv(3);
+    b << 1.0, 2.0, 3.0;
+    h0_inv << 0.25, 1.0 / 3.0, 0.5;
+
+    LBFGS lbfgs(5);
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(3);
+    Eigen::VectorXd g = -b;
+
+    SECTION("Without history the step is preconditioned steepest descent") {
+        auto s = lbfgs.step(g, h0_inv);
+        for(Eigen::Index i = 0; i < 3; ++i)
+            REQUIRE_THAT(s[i], WithinAbs(h0_inv[i] * b[i], 1E-14));
+    }
+
+    SECTION("Converges") {
+        for(int k = 0; k < 10; ++k) {
+            auto s = lbfgs.step(g, h0_inv);
+            x += s;
+            Eigen::VectorXd g_new = A * x - b;
+            lbfgs.push(s, g_new - g);
+            g = g_new;
+        }
+        REQUIRE(g.norm() < 1E-8);
+        REQUIRE(lbfgs.size() == 5);
+    }
+
+    SECTION("Negative curvature pairs are skipped") {
+        Eigen::VectorXd s(3);
+        s << 1.0, 0.0, 0.0;
+        lbfgs.push(s, -s);
+        REQUIRE(lbfgs.size() == 0);
+    }
+}
+
+TEST_CASE("exp_rotation") {
+    const auto I = Eigen::MatrixXd::Identity(3, 3);
+
+    SECTION("One occupied orbital") {
+        Eigen::MatrixXd kappa(2, 1);
+        kappa << 0.3, -0.2;
+        auto U = exp_rotation(kappa, {0}, {1, 2}, 3);
+        REQUIRE((U.transpose() * U - I).norm() < 1E-14);
+
+        // Rotation by theta = |kappa| in the plane of orbital 0 and kappa
+        const double theta = std::sqrt(0.13);
+        REQUIRE_THAT(U(0, 0), WithinAbs(std::cos(theta), 1E-14));
+        REQUIRE_THAT(U(1, 0), WithinAbs(std::sin(theta) * 0.3 / theta, 1E-14));
+        REQUIRE_THAT(U(2, 0),
+                     WithinAbs(-std::sin(theta) * 0.2 / theta, 1E-14));
+    }
+
+    SECTION("Agrees with the power series of exp(K)") {
+        // Two occupied orbitals (1 and 3) among five
+        std::vector<std::size_t> occ{1, 3}, vir{0, 2, 4};
+        Eigen::MatrixXd kappa(3, 2);
+        kappa << 0.3, -0.1, 0.2, 0.4, -0.5, 0.1;
+
+        Eigen::MatrixXd K = Eigen::MatrixXd::Zero(5, 5);
+        for(std::size_t a = 0; a < 3; ++a) {
+            for(std::size_t i = 0; i < 2; ++i) {
+                K(vir[a], occ[i]) = kappa(a, i);
+                K(occ[i], vir[a]) = -kappa(a, i);
+            }
+        }
+        Eigen::MatrixXd term = Eigen::MatrixXd::Identity(5, 5);
+        Eigen::MatrixXd corr = term;
+        for(int k = 1; k < 30; ++k) {
+            term = term * K / k;
+            corr += term;
+        }
+        REQUIRE((exp_rotation(kappa, occ, vir, 5) - corr).norm() < 1E-13);
+
+        // Rotating orbitals is the same as multiplying by exp(K)
+        Eigen::MatrixXd C(4, 5);
+        C << 1.0, 0.2, 0.0, 0.3, 0.1, 0.0, 1.0, 0.4, 0.0, 0.2, 0.5, 0.0, 1.0,
+          0.1, 0.0, 0.0, 0.3, 0.2, 1.0, 0.6;
+        REQUIRE((rotate_orbitals(C, kappa, occ, vir) - C * corr).norm() <
+                1E-13);
+    }
+}
+
+TEST_CASE("GDMHistory") {
+    using vector_type = GDMHistory::vector_type;
+    vector_type g(2), d(2), s(2), y(2);
+    g << 1.0, -2.0;
+    d << 0.1, 0.2;
+    s << 0.3, -0.1;
+    y << 0.5, 0.4;
+    GDMHistory history{g, d, LBFGS(3)};
+    history.lbfgs.push(s, y);
+
+    const auto rows = history.pack();
+    REQUIRE(rows == std::vector<double>{1.0, -2.0, 0.1, 0.2, 0.3, -0.1, 0.5,
+                                        0.4});
+
+    SECTION("Round trip") {
+        auto other = GDMHistory::unpack(rows, 2, 3);
+        REQUIRE(other.has_value());
+        REQUIRE(other->gradient == g);
+        REQUIRE(other->step == d);
+        REQUIRE(other->lbfgs.size() == 1);
+        REQUIRE(other->lbfgs.s(0) == s);
+        REQUIRE(other->lbfgs.y(0) == y);
+    }
+
+    SECTION("No history") {
+        REQUIRE_FALSE(GDMHistory::unpack({}, 2, 3).has_value());
+        REQUIRE_FALSE(GDMHistory::unpack(rows, 3, 3).has_value());
+    }
+}
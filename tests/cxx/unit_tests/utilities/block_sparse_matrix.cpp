@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_scf.hpp"
+#include "utilities/block_sparse_matrix.hpp"
+#include <cmath>
+
+using namespace scf::utilities;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("BlockSparseMatrix") {
+    using matrix_type = BlockSparseMatrix<double>;
+
+    // 4 by 4, tiled 1 + 2 + 1; the (0, 2) and (2, 0) blocks are tiny
+    const block_offsets offsets{0, 1, 3, 4};
+    const std::vector<double> A{1.0, 2.0, 0.0, 1.0E-9, //
+                                2.0, 3.0, 1.0, 0.5,    //
+                                0.0, 1.0, 4.0, 0.0,    //
+                                1.0E-9, 0.5, 0.0, 2.0};
+    const std::vector<double> B{2.0, 0.0, 1.0, 0.0,  //
+                                0.0, 1.0, 0.0, -1.0, //
+                                1.0, 0.0, 3.0, 0.0,  //
+                                0.0, -1.0, 0.0, 1.0};
+
+    auto dense_product = [](const auto& X, const auto& Y) {
+        std::vector<double> Z(16, 0.0);
+        for(std::size_t i = 0; i < 4; ++i)
+            for(std::size_t j = 0; j < 4; ++j)
+                for(std::size_t k = 0; k < 4; ++k)
+                    Z[i * 4 + j] += X[i * 4 + k] * Y[k * 4 + j];
+        return Z;
+    };
+
+    SECTION("tilings") {
+        auto aos = test_scf::h2_aos().ao_basis_set();
+        REQUIRE(shell_offsets(aos) == block_offsets{0, 1, 2});
+        REQUIRE(atom_offsets(aos) == block_offsets{0, 1, 2});
+        REQUIRE_THROWS_AS(matrix_type(block_offsets{1, 2}), std::runtime_error);
+    }
+
+    SECTION("from_dense/to_dense") {
+        auto a = matrix_type::from_dense(A.data(), offsets, 1.0E-6);
+        REQUIRE(a.dimension() == 4);
+        REQUIRE(a.n_block_rows() == 3);
+        REQUIRE(a.n_blocks() == 7);
+        REQUIRE(a.n_elements() == 14);
+
+        auto corr = A;
+        corr[3]   = 0.0;
+        corr[12]  = 0.0;
+        REQUIRE(a.to_dense() == corr);
+
+        auto all = matrix_type::from_dense(A.data(), offsets, 0.0);
+        REQUIRE(all.to_dense() == A);
+        REQUIRE_THAT(all.norm(), WithinAbs(std::sqrt(40.5 + 2.0E-18), 1E-12));
+    }
+
+    SECTION("transpose") {
+        auto b  = matrix_type::from_dense(B.data(), offsets, 0.0);
+        auto bt = b.transpose().to_dense();
+        for(std::size_t i = 0; i < 4; ++i)
+            for(std::size_t j = 0; j < 4; ++j)
+                REQUIRE(bt[i * 4 + j] == B[j * 4 + i]);
+    }
+
+    SECTION("dot") {
+        auto a = matrix_type::from_dense(A.data(), offsets, 1.0E-6);
+        auto b = matrix_type::from_dense(B.data(), offsets, 0.0);
+        double corr = 0.0;
+        for(std::size_t i = 0; i < 16; ++i) corr += A[i] * B[i];
+        REQUIRE_THAT(a.dot(b), WithinAbs(corr, 1E-14));
+        REQUIRE_THAT(a.dot(a), WithinAbs(a.norm() * a.norm(), 1E-12));
+    }
+
+    SECTION("add") {
+        auto a = matrix_type::from_dense(A.data(), offsets, 1.0E-6);
+        auto b = matrix_type::from_dense(B.data(), offsets, 0.0);
+        auto c = a.add(b, -2.0).to_dense();
+        auto d = a.to_dense();
+        for(std::size_t i = 0; i < 16; ++i)
+            REQUIRE_THAT(c[i], WithinAbs(d[i] - 2.0 * B[i], 1E-14));
+    }
+
+    SECTION("multiply") {
+        auto a = matrix_type::from_dense(A.data(), offsets, 0.0);
+        auto b = matrix_type::from_dense(B.data(), offsets, 0.0);
+
+        auto corr = dense_product(A, B);
+        for(std::size_t n_threads : {1, 3}) {
+            auto c = a.multiply(b, 0.0, n_threads).to_dense();
+            for(std::size_t i = 0; i < 16; ++i)
+                REQUIRE_THAT(c[i], WithinAbs(corr[i], 1E-14));
+        }
+
+        // Screening only drops the products of the tiny blocks
+        auto c = a.multiply(b, 1.0E-6).to_dense();
+        for(std::size_t i = 0; i < 16; ++i)
+            REQUIRE_THAT(c[i], WithinAbs(corr[i], 1E-8));
+    }
+
+    SECTION("screen_blocks") {
+        auto a = A;
+        REQUIRE(screen_blocks(a.data(), offsets, 1.0E-6) == 7);
+        REQUIRE(a[3] == 0.0);
+        REQUIRE(a[12] == 0.0);
+        REQUIRE(a[0] == 1.0);
+    }
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/parallel_for.hpp"
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <vector>
+
+using scf::utilities::parallel_for;
+
+TEST_CASE("parallel_for") {
+    SECTION("empty range") {
+        bool called = false;
+        parallel_for(0, [&](std::size_t, std::size_t) { called = true; });
+        REQUIRE_FALSE(called);
+    }
+
+    SECTION("chunks cover the range exactly once") {
+        for(std::size_t n_threads : {1, 2, 3, 8, 64}) {
+            const std::size_t n = 37;
+            std::vector<int> hits(n, 0);
+            parallel_for(
+              n,
+              [&](std::size_t begin, std::size_t end) {
+                  for(auto i = begin; i < end; ++i) ++hits[i];
+              },
+              n_threads);
+            for(auto h : hits) REQUIRE(h == 1);
+        }
+    }
+
+    SECTION("number of chunks") {
+        std::atomic<std::size_t> n_calls{0};
+        parallel_for(
+          10, [&](std::size_t, std::size_t) { ++n_calls; }, 4);
+        REQUIRE(n_calls == 4);
+    }
+
+    SECTION("exceptions are rethrown") {
+        auto f = [](std::size_t begin, std::size_t) {
+            if(begin > 0) throw std::runtime_error("chunk failed");
+        };
+        REQUIRE_THROWS_AS(parallel_for(8, f, 4), std::runtime_error);
+    }
+}